@@ -13,6 +13,8 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         private int _calculator = -1;
         private readonly Mutex _calculatorMutex;
         private int _maximumPossibleCoefficientCount;
+        private double[] _errorHistory;
+        private static int _shutdownRegistered;
 
         public HolomorphicEmbeddedLoadFlowMethod(string dllPath, double targetPrecision, int numberOfCoefficients, int bitPrecision, bool iterativeSolver) :
             this(targetPrecision, numberOfCoefficients, bitPrecision, iterativeSolver) 
@@ -34,6 +36,7 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             IterativeSolver = iterativeSolver;
             _calculatorMutex = new Mutex();
             _maximumPossibleCoefficientCount = -1;
+            _errorHistory = new double[0];
         }
 
         public double MaximumRelativePowerError
@@ -77,6 +80,11 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             }
         }
 
+        public IReadOnlyList<double> ErrorHistory
+        {
+            get { return _errorHistory; }
+        }
+
         public void ResetProgress()
         { }
 
@@ -100,8 +108,9 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         {
             CalculateUnknownVoltagesInternal(admittances, totalAdmittanceRowSums, nominalVoltage, constantCurrents, pqBuses, pvBuses);
             coefficients = new List<Vector<Complex>>(NumberOfCoefficients);
+            var availableStepCount = Math.Min(stepCount, HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetCoefficientCount(_calculator));
 
-            for (var i = 0; i < stepCount; ++i)
+            for (var i = 0; i < availableStepCount; ++i)
                 coefficients.Add(FetchCoefficients(i, admittances.NodeCount, _calculator));
 
             var voltages = FetchVoltages(admittances.NodeCount, _calculator);
@@ -124,66 +133,115 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             HolomorphicEmbeddedLoadFlowMethodNativeMethods.Calculate(_calculator);
             _maximumPossibleCoefficientCount =
                 HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetMaximumPossibleCoefficientCount(_calculator);
+            _errorHistory = FetchErrorHistory(_calculator);
+        }
+
+        private static double[] FetchErrorHistory(int calculator)
+        {
+            var errors = new double[HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetErrorHistoryCount(calculator)];
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetErrorHistory(calculator, errors);
+            return errors;
         }
 
         private Vector<Complex> FetchCoefficients(int step, int nodeCount, int calculator)
         {
-            var result = new DenseVector(nodeCount);
+            var real = new double[nodeCount];
+            var imaginary = new double[nodeCount];
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetCoefficients(calculator, step, real, imaginary);
+            return CreateComplexVector(real, imaginary);
+        }
 
-            for (var i = 0; i < nodeCount; ++i)
-                result[i] = new Complex(HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetCoefficientReal(calculator, step, i), HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetCoefficientImaginary(calculator, step, i));
+        private Vector<Complex> FetchVoltages(int nodeCount, int calculator)
+        {
+            var real = new double[nodeCount];
+            var imaginary = new double[nodeCount];
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetVoltages(calculator, real, imaginary);
+            return CreateComplexVector(real, imaginary);
+        }
+
+        private static Vector<Complex> CreateComplexVector(IReadOnlyList<double> real, IReadOnlyList<double> imaginary)
+        {
+            var result = new DenseVector(real.Count);
+
+            for (var i = 0; i < real.Count; ++i)
+                result[i] = new Complex(real[i], imaginary[i]);
 
             return result;
         }
 
-        private Vector<Complex> FetchVoltages(int nodeCount, int calculator)
+        private static void SetRightHandSideValues(IList<Complex> constantCurrents, IList<PqNodeWithIndex> pqBuses, IList<PvNodeWithIndex> pvBuses, int nodeCount, int calculator)
         {
-            var voltages = new DenseVector(nodeCount);
+            var constantCurrentsReal = new double[nodeCount];
+            var constantCurrentsImaginary = new double[nodeCount];
 
             for (var i = 0; i < nodeCount; ++i)
             {
-                var real = HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetVoltageReal(calculator, i);
-                var imaginary = HolomorphicEmbeddedLoadFlowMethodNativeMethods.GetVoltageImaginary(calculator, i);
-                voltages[i] = new Complex(real, imaginary);
+                constantCurrentsReal[i] = constantCurrents[i].Real;
+                constantCurrentsImaginary[i] = constantCurrents[i].Imaginary;
             }
 
-            return voltages;
-        }
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetConstantCurrents(calculator, constantCurrentsReal, constantCurrentsImaginary);
 
-        private static void SetRightHandSideValues(IList<Complex> constantCurrents, IList<PqNodeWithIndex> pqBuses, IList<PvNodeWithIndex> pvBuses, int nodeCount, int calculator)
-        {
-            for (var i = 0; i < nodeCount; ++i)
-                HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetConstantCurrent(calculator, i, constantCurrents[i].Real,
-                    constantCurrents[i].Imaginary);
+            var pqNodes = new int[pqBuses.Count];
+            var pqPowersReal = new double[pqBuses.Count];
+            var pqPowersImaginary = new double[pqBuses.Count];
 
             for (var i = 0; i < pqBuses.Count; ++i)
-                HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetPQBus(calculator, i, pqBuses[i].Index, pqBuses[i].Power.Real,
-                    pqBuses[i].Power.Imaginary);
+            {
+                pqNodes[i] = pqBuses[i].Index;
+                pqPowersReal[i] = pqBuses[i].Power.Real;
+                pqPowersImaginary[i] = pqBuses[i].Power.Imaginary;
+            }
+
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetPQBuses(calculator, pqNodes, pqPowersReal, pqPowersImaginary);
+
+            var pvNodes = new int[pvBuses.Count];
+            var pvPowersReal = new double[pvBuses.Count];
+            var pvVoltageMagnitudes = new double[pvBuses.Count];
 
             for (var i = 0; i < pvBuses.Count; ++i)
-                HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetPVBus(calculator, i, pvBuses[i].Index, pvBuses[i].RealPower,
-                    pvBuses[i].VoltageMagnitude);
+            {
+                pvNodes[i] = pvBuses[i].Index;
+                pvPowersReal[i] = pvBuses[i].RealPower;
+                pvVoltageMagnitudes[i] = pvBuses[i].VoltageMagnitude;
+            }
+
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetPVBuses(calculator, pvNodes, pvPowersReal, pvVoltageMagnitudes);
         }
 
         private static void SetAdmittanceValues(IReadOnlyAdmittanceMatrix admittances, IList<Complex> totalAdmittanceRowSums, int calculator)
         {
+            var rows = new List<int>();
+            var columns = new List<int>();
+            var valuesReal = new List<double>();
+            var valuesImaginary = new List<double>();
+
             foreach (var entry in admittances.EnumerateIndexed())
             {
-                var value = entry.Item3;
-                HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetAdmittance(calculator, entry.Item1, entry.Item2, value.Real,
-                    value.Imaginary);
+                rows.Add(entry.Item1);
+                columns.Add(entry.Item2);
+                valuesReal.Add(entry.Item3.Real);
+                valuesImaginary.Add(entry.Item3.Imaginary);
             }
+
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetAdmittances(calculator, rows.Count, rows.ToArray(), columns.ToArray(),
+                valuesReal.ToArray(), valuesImaginary.ToArray());
+
+            var rowSumsReal = new double[admittances.NodeCount];
+            var rowSumsImaginary = new double[admittances.NodeCount];
             
             for (var row = 0; row < admittances.NodeCount; ++row)
             {
-                var totalRowSum = totalAdmittanceRowSums[row];
-                HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetAdmittanceRowSum(calculator, row, totalRowSum.Real,
-                    totalRowSum.Imaginary);
+                rowSumsReal[row] = totalAdmittanceRowSums[row].Real;
+                rowSumsImaginary[row] = totalAdmittanceRowSums[row].Imaginary;
             }
+
+            HolomorphicEmbeddedLoadFlowMethodNativeMethods.SetAdmittanceRowSums(calculator, rowSumsReal, rowSumsImaginary);
         }
 
         private int CreateNewCalculator(double nominalVoltage, ICollection<PqNodeWithIndex> pqBuses, ICollection<PvNodeWithIndex> pvBuses, int nodeCount)
         {
+            RegisterShutdown();
             int calculator;
 
             if (BitPrecision <= 64)
@@ -203,6 +261,16 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             return calculator;
         }
 
+        // the native workers must be stopped before the DLL is unloaded, as this is not possible during its unloading
+        private static void RegisterShutdown()
+        {
+            if (Interlocked.Exchange(ref _shutdownRegistered, 1) != 0)
+                return;
+
+            AppDomain.CurrentDomain.ProcessExit += (sender, e) => HolomorphicEmbeddedLoadFlowMethodNativeMethods.ShutdownCalculations();
+            AppDomain.CurrentDomain.DomainUnload += (sender, e) => HolomorphicEmbeddedLoadFlowMethodNativeMethods.ShutdownCalculations();
+        }
+
         [DllImport("kernel32.dll")]
         static extern bool SetDllDirectory(string yourPath);
     }
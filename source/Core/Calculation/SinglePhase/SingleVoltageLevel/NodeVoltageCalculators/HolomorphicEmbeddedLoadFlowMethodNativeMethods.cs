@@ -28,6 +28,24 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         public static extern void SetConstantCurrent(int calculator, int node, double real, double imaginary);
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetAdmittances(int calculator, int count, int[] rows, int[] columns, double[] real, double[] imaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetAdmittancesCompressed(int calculator, int[] rowPointers, int[] columns, double[] real, double[] imaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetAdmittanceRowSums(int calculator, double[] real, double[] imaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetPQBuses(int calculator, int[] nodes, double[] powerReal, double[] powerImaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetPVBuses(int calculator, int[] nodes, double[] powerReal, double[] voltageMagnitude);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void SetConstantCurrents(int calculator, double[] real, double[] imaginary);
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         public static extern void Calculate(int calculator);
 
@@ -43,6 +61,24 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         public static extern double GetCoefficientImaginary(int calculator, int step, int node);
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void GetVoltages(int calculator, [Out] double[] real, [Out] double[] imaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void GetCoefficients(int calculator, int step, [Out] double[] real, [Out] double[] imaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void GetInverseCoefficients(int calculator, int step, [Out] double[] real, [Out] double[] imaginary);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern int GetErrorHistoryCount(int calculator);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void GetErrorHistory(int calculator, [Out] double[] errors);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern int GetCoefficientCount(int calculator);
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         public static extern double GetProgress(int calculator);
 
@@ -51,5 +87,8 @@ namespace Calculation.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
 
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         public static extern int GetMaximumPossibleCoefficientCount(int calculator);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern void ShutdownCalculations();
     }
 }
\ No newline at end of file
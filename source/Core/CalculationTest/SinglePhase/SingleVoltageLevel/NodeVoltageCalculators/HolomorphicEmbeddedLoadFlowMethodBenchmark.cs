@@ -0,0 +1,211 @@
+﻿using System;
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
+{
+    [TestClass]
+    public class HolomorphicEmbeddedLoadFlowMethodBenchmark
+    {
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void SparseMatrixMultiply()
+        {
+            var rowWise = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkSparseMatrixMultiply(false, 100);
+            var frozen = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkSparseMatrixMultiply(true, 100);
+
+            Console.WriteLine("sparse matrix multiply, row wise: {0} s, frozen: {1} s, speedup: {2}", rowWise, frozen, rowWise/frozen);
+            Assert.IsTrue(rowWise > 0);
+            Assert.IsTrue(frozen > 0);
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void LUDecomposition()
+        {
+            var complete = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUDecomposition(false, 3);
+            var numericOnly = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUDecomposition(true, 3);
+
+            Console.WriteLine("LU decomposition, complete: {0} s, numeric only: {1} s, speedup: {2}", complete, numericOnly, complete/numericOnly);
+            Assert.IsTrue(complete > 0);
+            Assert.IsTrue(numericOnly > 0);
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void LUDecompositionOrdering()
+        {
+            var orderings = new[] { "reverse Cuthill-McKee", "minimum degree" };
+
+            for (var ordering = 0; ordering < orderings.Length; ++ordering)
+                foreach (var stable in new[] { true, false })
+                {
+                    int nonZeroCount;
+                    var time = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUDecompositionOrdering(ordering, stable, out nonZeroCount);
+                    Console.WriteLine("LU decomposition, {0}, {1} pivoting: nnz(L+U) = {2}, {3} s", orderings[ordering], stable ? "biggest element" : "smallest fill-in", nonZeroCount, time);
+                    Assert.IsTrue(nonZeroCount > 0);
+                }
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void LUDecompositionRadial()
+        {
+            var previous = 0.0;
+
+            foreach (var nodeCount in new[] { 2000, 4000, 8000, 16000 })
+            {
+                var time = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUDecompositionRadial(nodeCount, true);
+                Console.WriteLine("LU decomposition of a radial grid with {0} nodes: {1} s, ratio to half the nodes: {2}", nodeCount, time, previous > 0 ? time/previous : 0);
+                Assert.IsTrue(time > 0);
+                previous = time;
+            }
+        }
+
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void Summation()
+        {
+            var summations = new[] { "naive", "Neumaier", "pairwise", "sorted" };
+
+            for (var summation = 0; summation < summations.Length; ++summation)
+            {
+                double relativeError;
+                var multiplyTime = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkSparseMatrixMultiplySummation(summation, 100);
+                var dotTime = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkVectorDotSummation(summation, 1000000, out relativeError);
+                Console.WriteLine("summation {0}: sparse matrix multiply {1} s, ill-conditioned dot product {2} s with relative error {3}", summations[summation], multiplyTime, dotTime, relativeError);
+                Assert.IsTrue(multiplyTime > 0);
+                Assert.IsTrue(dotTime > 0);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void BatchCalculation()
+        {
+            foreach (var scenarioCount in new[] { 1, 4, 16, 64 })
+            {
+                var batched = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkBatchCalculation(200, scenarioCount, true);
+                var separate = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkBatchCalculation(200, scenarioCount, false);
+                Console.WriteLine("{0} scenarios: batched {1} scenarios/s, separate calculators {2} scenarios/s, speedup: {3}", scenarioCount, batched, separate, batched/separate);
+                Assert.IsTrue(batched > 0);
+                Assert.IsTrue(separate > 0);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void LUSubstitution()
+        {
+            foreach (var meshed in new[] { false, true })
+            {
+                int levelCount;
+                var sequential = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUSubstitution(meshed, 1, 20, out levelCount);
+                var parallel = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUSubstitution(meshed, Environment.ProcessorCount, 20, out levelCount);
+                Console.WriteLine("LU substitution, {0} network with {1} levels: one thread {2} s, {3} threads {4} s, speedup: {5}", meshed ? "meshed" : "radial", levelCount, sequential, Environment.ProcessorCount, parallel, sequential/parallel);
+                Assert.IsTrue(levelCount > 0);
+                Assert.IsTrue(sequential > 0);
+                Assert.IsTrue(parallel > 0);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void CalculatorPrecision()
+        {
+            var names = new[] { "long double", "double-double", "quad-double", "MPIR 128 bit", "MPIR 256 bit", "double" };
+
+            for (var floatingType = 0; floatingType < names.Length; ++floatingType)
+            {
+                double relativePowerError;
+                var time = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkCalculatorPrecision(floatingType, 200, out relativePowerError);
+                Console.WriteLine("{0}: {1} s, relative power error {2}", names[floatingType], time, relativePowerError);
+                Assert.IsTrue(time > 0);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void MultiPrecisionConvolution()
+        {
+            long operatorAllocations;
+            long fusedAllocations;
+            var operators = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkMultiPrecisionConvolution(false, 1000, out operatorAllocations);
+            var fused = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkMultiPrecisionConvolution(true, 1000, out fusedAllocations);
+            Console.WriteLine("operators: {0} s with {1} allocations, fused kernels: {2} s with {3} allocations, speedup: {4}", operators, operatorAllocations, fused, fusedAllocations, operators/fused);
+            Assert.AreEqual(0, fusedAllocations);
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void CalculatorThroughput()
+        {
+            foreach (var nodeCount in new[] { 10, 200 })
+            {
+                var sequential = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkCalculatorThroughput(nodeCount, 200, false);
+                var concurrent = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkCalculatorThroughput(nodeCount, 200, true);
+                Console.WriteLine("{0} nodes: sequential {1} calculations/s, concurrent {2} calculations/s, speedup: {3}", nodeCount, sequential, concurrent, concurrent/sequential);
+                Assert.IsTrue(sequential > 0);
+                Assert.IsTrue(concurrent > 0);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void AnalyticContinuation()
+        {
+            foreach (var loadFactor in new[] { 0.5, 1.0, 2.0, 3.0, 4.0 })
+            {
+                double epsilonError;
+                double viskovatovError;
+                var epsilon = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkAnalyticContinuation(0, 200, loadFactor, out epsilonError);
+                var viskovatov = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkAnalyticContinuation(1, 200, loadFactor, out viskovatovError);
+                Console.WriteLine("load factor {0}: epsilon algorithm {1} coefficients with relative power error {2}, Viskovatov {3} coefficients with relative power error {4}", loadFactor, epsilon, epsilonError, viskovatov, viskovatovError);
+                Assert.IsTrue(epsilon > 0);
+                Assert.IsTrue(viskovatov > 0);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void RelaxedConvolution()
+        {
+            foreach (var count in new[] { 100, 200, 500, 1000 })
+            {
+                double directError;
+                double relaxedError;
+                var direct = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkRelaxedConvolution(false, count, out directError);
+                var relaxed = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkRelaxedConvolution(true, count, out relaxedError);
+                Console.WriteLine("{0} coefficients: direct {1} s with a relative error of {2}, relaxed {3} s with a relative error of {4}, speedup: {5}", count, direct, directError, relaxed, relaxedError, direct/relaxed);
+                Assert.IsTrue(relaxedError < 1e-60);
+            }
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void BiCGSTABPreconditioner()
+        {
+            int iterationCount;
+            int levelCount;
+            double setupTime;
+            var incompleteLUThreshold = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkBiCGSTABPreconditioner(2, 3, out iterationCount, out setupTime);
+            var luSubstitution = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkLUSubstitution(true, Environment.ProcessorCount, 3, out levelCount);
+            Console.WriteLine("BiCGSTAB with ILUT: {0} iterations, setup {1} s, solve {2} s, LU substitution: {3} s", iterationCount, setupTime, incompleteLUThreshold, luSubstitution);
+            Assert.IsTrue(iterationCount < 100);
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void SolutionHistory()
+        {
+            double coldStartError;
+            double solutionHistoryError;
+            var coldStart = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkSolutionHistory(0, 300, out coldStartError);
+            var solutionHistory = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkSolutionHistory(16, 300, out solutionHistoryError);
+            Console.WriteLine("iterative solver without history: {0} s, with the last 16 solutions: {1} s, speedup: {2}", coldStart, solutionHistory, coldStart/solutionHistory);
+            Assert.AreEqual(coldStartError, solutionHistoryError, 1e-5);
+        }
+        [TestMethod]
+        [TestCategory("Benchmark")]
+        public void VectorOperationsDouble()
+        {
+            var longDouble = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkVectorOperationsDouble(false, 100000, 100);
+            var vectorized = HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods.BenchmarkVectorOperationsDouble(true, 100000, 100);
+            Console.WriteLine("vector operations with long double: {0} s, with the vectorized kernels for double: {1} s, speedup: {2}", longDouble, vectorized, longDouble/vectorized);
+            Assert.IsTrue(longDouble > 0);
+            Assert.IsTrue(vectorized > 0);
+        }
+
+
+    }
+}
@@ -0,0 +1,47 @@
+﻿using System.Runtime.InteropServices;
+
+namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
+{
+    class HolomorphicEmbeddedLoadFlowMethodBenchmarkNativeMethods
+    {
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkSparseMatrixMultiply([MarshalAs(UnmanagedType.I1)] bool frozen, int repetitions);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkLUDecomposition([MarshalAs(UnmanagedType.I1)] bool numericOnly, int repetitions);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkLUDecompositionOrdering(int ordering, [MarshalAs(UnmanagedType.I1)] bool stable, out int nonZeroCount);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkLUDecompositionRadial(int nodeCount, [MarshalAs(UnmanagedType.I1)] bool stable);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkSparseMatrixMultiplySummation(int summation, int repetitions);
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkVectorDotSummation(int summation, int count, out double relativeError);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkBatchCalculation(int nodeCount, int scenarioCount, [MarshalAs(UnmanagedType.I1)] bool batched);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkLUSubstitution([MarshalAs(UnmanagedType.I1)] bool meshed, int threadCount, int repetitions, out int levelCount);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkCalculatorPrecision(int floatingType, int nodeCount, out double relativePowerError);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkMultiPrecisionConvolution([MarshalAs(UnmanagedType.I1)] bool fused, int count, out long allocationCount);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkCalculatorThroughput(int nodeCount, int calculationCount, [MarshalAs(UnmanagedType.I1)] bool concurrent);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern int BenchmarkAnalyticContinuation(int method, int nodeCount, double loadFactor, out double relativePowerError);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkRelaxedConvolution([MarshalAs(UnmanagedType.I1)] bool relaxed, int count, out double relativeError);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkBiCGSTABPreconditioner(int preconditioner, int repetitions, out int iterationCount, out double setupTime);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkSolutionHistory(int historyLength, int nodeCount, out double relativePowerError);
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        public static extern double BenchmarkVectorOperationsDouble([MarshalAs(UnmanagedType.I1)] bool useDouble, int count, int repetitions);
+
+
+    }
+}
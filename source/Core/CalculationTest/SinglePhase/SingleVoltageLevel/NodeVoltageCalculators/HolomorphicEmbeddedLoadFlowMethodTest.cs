@@ -24,6 +24,42 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsMultiPrecision());
         }
 
+        [TestMethod]
+        public void MultiPrecisionAllocations()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsMultiPrecisionAllocations());
+        }
+
+        [TestMethod]
+        public void MultiPrecisionScope()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsMultiPrecisionScope());
+        }
+
+        [TestMethod]
+        public void MultiPrecisionScratchAfterHigherPrecision()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsMultiPrecisionScratchAfterHigherPrecision());
+        }
+
+        [TestMethod]
+        public void MultiPrecisionScopeInParallelRegions()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsMultiPrecisionScopeInParallelRegions());
+        }
+
+        [TestMethod]
+        public void DoubleDouble()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsDoubleDouble());
+        }
+
+        [TestMethod]
+        public void QuadDouble()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsQuadDouble());
+        }
+
         [TestMethod]
         public void CoefficientStoragePQ()
         {
@@ -42,6 +78,24 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCoefficientStorageMixed());
         }
 
+        [TestMethod]
+        public void CoefficientStorageLayouts()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCoefficientStorageLayouts());
+        }
+
+        [TestMethod]
+        public void CoefficientStorageRelaxedConvolution()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCoefficientStorageRelaxedConvolution());
+        }
+
+        [TestMethod]
+        public void RelaxedConvolutionDouble()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsRelaxedConvolutionDouble());
+        }
+
         [TestMethod]
         public void AnalyticContinuationStepByStep()
         {
@@ -54,6 +108,12 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsAnalyticContinuationBunchAtOnce());
         }
 
+        [TestMethod]
+        public void AnalyticContinuationViskovatov()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsAnalyticContinuationViskovatov());
+        }
+
         [TestMethod]
         public void LinearEquationSystemOne()
         {
@@ -96,6 +156,174 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemSeven());
         }
 
+        [TestMethod]
+        public void LinearEquationSystemRefactorization()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemRefactorization());
+        }
+
+        [TestMethod]
+        public void LinearEquationSystemRefactorizationWithDifferentPattern()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemRefactorizationWithDifferentPattern());
+        }
+
+        [TestMethod]
+        public void LinearEquationSystemMultipleRightHandSides()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemMultipleRightHandSides());
+        }
+
+        [TestMethod]
+        public void LinearEquationSystemLevels()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemLevels());
+        }
+
+        [TestMethod]
+        public void LinearEquationSystemPivotingWithFillIn()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemPivotingWithFillIn());
+        }
+
+        [TestMethod]
+        public void PreconditionerIncompleteLU()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsPreconditionerIncompleteLU());
+        }
+
+        [TestMethod]
+        public void BiCGSTABPreconditioners()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsBiCGSTABPreconditioners());
+        }
+
+        [TestMethod]
+        public void SolutionHistory()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSolutionHistory());
+        }
+
+        [TestMethod]
+        public void LinearEquationSystemWithoutAllocations()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemWithoutAllocations());
+        }
+
+        [TestMethod]
+        public void LinearEquationSystemMinimumDegree()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsLinearEquationSystemMinimumDegree());
+        }
+
+        [TestMethod]
+        public void CalculatorBulkInterface()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorBulkInterface());
+        }
+
+        [TestMethod]
+        public void CalculatorEarlyTermination()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorEarlyTermination());
+        }
+
+        [TestMethod]
+        public void CalculatorStallDetection()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorStallDetection());
+        }
+
+        [TestMethod]
+        public void CalculatorSolutionHistory()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorSolutionHistory());
+        }
+
+        [TestMethod]
+        public void CalculatorIterativeSolverTolerance()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorIterativeSolverTolerance());
+        }
+
+        [TestMethod]
+        public void CalculatorCoefficientsWithoutAllocations()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorCoefficientsWithoutAllocations());
+        }
+
+        [TestMethod]
+        public void CalculatorErrorHistory()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorErrorHistory());
+        }
+
+        [TestMethod]
+        public void CalculatorBatch()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorBatch());
+        }
+
+        [TestMethod]
+        public void CalculatorBatchWithDifferentBuses()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorBatchWithDifferentBuses());
+        }
+
+        [TestMethod]
+        public void CalculatorExtendedPrecision()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorExtendedPrecision());
+        }
+
+        [TestMethod]
+        public void CalculatorDouble()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorDouble());
+        }
+
+        [TestMethod]
+        public void CalculatorMultiPrecisionConcurrent()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorMultiPrecisionConcurrent());
+        }
+
+        [TestMethod]
+        public void CalculatorCancellation()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorCancellation());
+        }
+
+        [TestMethod]
+        public void CalculatorRegisterAsync()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorRegisterAsync());
+        }
+
+        [TestMethod]
+        public void CalculatorRegisterIds()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorRegisterIds());
+        }
+
+        [TestMethod]
+        public void CalculatorContinuationInterval()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorContinuationInterval());
+        }
+
+        [TestMethod]
+        public void CalculatorSentinelNodes()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorSentinelNodes());
+        }
+
+        [TestMethod]
+        public void CalculatorViskovatov()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsCalculatorViskovatov());
+        }
+
         [TestMethod]
         public void VectorConstructor()
         {
@@ -114,6 +342,12 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorAssignment());
         }
 
+        [TestMethod]
+        public void VectorMove()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorMove());
+        }
+
         [TestMethod]
         public void VectorDotProduct()
         {
@@ -126,6 +360,18 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorSquaredNorm());
         }
 
+        [TestMethod]
+        public void Summation()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSummation());
+        }
+
+        [TestMethod]
+        public void VectorDotProductWithSummation()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorDotProductWithSummation());
+        }
+
         [TestMethod]
         public void VectorWeightedSum()
         {
@@ -162,12 +408,30 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorConjugate());
         }
 
+        [TestMethod]
+        public void VectorPermutate()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorPermutate());
+        }
+
         [TestMethod]
         public void VectorMultiPrecision()
         {
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorMultiPrecision());
         }
 
+        [TestMethod]
+        public void VectorMoveMultiPrecision()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorMoveMultiPrecision());
+        }
+
+        [TestMethod]
+        public void VectorDouble()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsVectorDouble());
+        }
+
         [TestMethod]
         public void SparseMatrixConstructor()
         {
@@ -198,6 +462,12 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixMultiply());
         }
 
+        [TestMethod]
+        public void SparseMatrixMultiplyDouble()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixMultiplyDouble());
+        }
+
         [TestMethod]
         public void SparseMatrixRowIteration()
         {
@@ -234,6 +504,12 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixAssignment());
         }
 
+        [TestMethod]
+        public void SparseMatrixMove()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixMove());
+        }
+
         [TestMethod]
         public void SparseMatrixGetRowValuesAndColumns()
         {
@@ -282,6 +558,18 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixMultiplyWithStartAndEndColumn());
         }
 
+        [TestMethod]
+        public void SparseMatrixFreeze()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixFreeze());
+        }
+
+        [TestMethod]
+        public void SparseMatrixSetWhileFrozen()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsSparseMatrixSetWhileFrozen());
+        }
+
         [TestMethod]
         public void GraphCalculateReverseCuthillMcKee()
         {
@@ -306,6 +594,12 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
             Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsGraphFindPseudoPeriphereNodeOfAdmittanceMatrix());
         }
 
+        [TestMethod]
+        public void GraphCalculateMinimumDegreeOrdering()
+        {
+            Assert.IsTrue(HolomorphicEmbeddedLoadFlowMethodTestNativeMethods.RunTestsGraphCalculateMinimumDegreeOrdering());
+        }
+
         public static void CalculateCorrectCoefficientsForTwoNodesWithImaginaryConnectionAndPVBusVersionTwo(out Complex a,
             out Complex b, out Complex c)
         {
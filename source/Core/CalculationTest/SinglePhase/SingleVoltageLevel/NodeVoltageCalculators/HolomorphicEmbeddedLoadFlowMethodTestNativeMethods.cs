@@ -16,6 +16,30 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsMultiPrecision();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsMultiPrecisionAllocations();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsMultiPrecisionScope();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsMultiPrecisionScratchAfterHigherPrecision();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsMultiPrecisionScopeInParallelRegions();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsDoubleDouble();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsQuadDouble();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsCoefficientStoragePQ();
@@ -28,6 +52,18 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsCoefficientStorageMixed();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCoefficientStorageLayouts();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCoefficientStorageRelaxedConvolution();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsRelaxedConvolutionDouble();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsAnalyticContinuationStepByStep();
@@ -36,6 +72,10 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsAnalyticContinuationBunchAtOnce();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsAnalyticContinuationViskovatov();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsLinearEquationSystemOne();
@@ -64,6 +104,118 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsLinearEquationSystemSeven();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemRefactorization();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemRefactorizationWithDifferentPattern();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemMultipleRightHandSides();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemLevels();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemPivotingWithFillIn();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsPreconditionerIncompleteLU();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsBiCGSTABPreconditioners();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsSolutionHistory();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemWithoutAllocations();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsLinearEquationSystemMinimumDegree();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorBulkInterface();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorEarlyTermination();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorStallDetection();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorSolutionHistory();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorIterativeSolverTolerance();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorCoefficientsWithoutAllocations();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorErrorHistory();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorBatch();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorBatchWithDifferentBuses();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorExtendedPrecision();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorDouble();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorMultiPrecisionConcurrent();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorCancellation();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorRegisterAsync();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorRegisterIds();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorContinuationInterval();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorSentinelNodes();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsCalculatorViskovatov();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorConstructor();
@@ -76,6 +228,10 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorAssignment();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsVectorMove();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorDotProduct();
@@ -84,6 +240,14 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorSquaredNorm();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsSummation();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsVectorDotProductWithSummation();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorWeightedSum();
@@ -108,10 +272,22 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorConjugate();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsVectorPermutate();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsVectorMultiPrecision();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsVectorMoveMultiPrecision();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsVectorDouble();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsSparseMatrixConstructor();
@@ -132,6 +308,10 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsSparseMatrixMultiply();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsSparseMatrixMultiplyDouble();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsSparseMatrixRowIteration();
@@ -156,6 +336,10 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsSparseMatrixAssignment();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsSparseMatrixMove();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsSparseMatrixGetRowValuesAndColumns();
@@ -188,6 +372,14 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsSparseMatrixMultiplyWithStartAndEndColumn();
 
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsSparseMatrixFreeze();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsSparseMatrixSetWhileFrozen();
+
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsGraphCalculateReverseCuthillMcKee();
@@ -203,5 +395,9 @@ namespace CalculationTest.SinglePhase.SingleVoltageLevel.NodeVoltageCalculators
         [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
         [return: MarshalAs(UnmanagedType.I1)]
         public static extern bool RunTestsGraphFindPseudoPeriphereNodeOfAdmittanceMatrix();
+
+        [DllImport("HELM.dll", CallingConvention = CallingConvention.Cdecl)]
+        [return: MarshalAs(UnmanagedType.I1)]
+        public static extern bool RunTestsGraphCalculateMinimumDegreeOrdering();
     }
 }
\ No newline at end of file
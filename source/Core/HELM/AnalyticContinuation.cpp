@@ -1,5 +1,7 @@
 #include "AnalyticContinuation.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "Complex.h"
 #include <vector>
 #include <assert.h>
@@ -9,6 +11,9 @@ using namespace std;
 
 template class AnalyticContinuation< long double, Complex<long double> >;
 template class AnalyticContinuation< MultiPrecision, Complex<MultiPrecision> >;
+template class AnalyticContinuation< DoubleDouble, Complex<DoubleDouble> >;
+template class AnalyticContinuation< QuadDouble, Complex<QuadDouble> >;
+template class AnalyticContinuation< double, Complex<double> >;
 
 template<typename Floating, typename ComplexFloating>
 AnalyticContinuation<Floating, ComplexFloating>::AnalyticContinuation(CoefficientStorage<ComplexFloating, Floating> const& coefficients, int node, int maximumNumberOfCoefficients) :
@@ -25,10 +30,18 @@ AnalyticContinuation<Floating, ComplexFloating>::AnalyticContinuation(Coefficien
 
 template<typename Floating, typename ComplexFloating>
 void AnalyticContinuation<Floating, ComplexFloating>::updateWithLastCoefficients()
+{	
+	updateWithCoefficients(_coefficients.getCoefficientCount());
+}
+
+// the continuation of a node can lag behind the coefficients, therefore it is possible to evaluate it only for some steps
+template<typename Floating, typename ComplexFloating>
+void AnalyticContinuation<Floating, ComplexFloating>::updateWithCoefficients(int coefficientCount)
 {	
 	assert(_alreadyProcessed < _maximumNumberOfCoefficients);
+	assert(coefficientCount <= _coefficients.getCoefficientCount());
 	
-	while (_alreadyProcessed < _coefficients.getCoefficientCount())
+	while (_alreadyProcessed < coefficientCount)
 		updateWithLastCoefficientsOnce();
 }
 
@@ -1,15 +1,18 @@
 #pragma once
 
+#include "IAnalyticContinuation.h"
 #include "CoefficientStorage.h"
 
+// Wynn's epsilon algorithm
 template<typename Floating, typename ComplexFloating>
-class AnalyticContinuation
+class AnalyticContinuation : public IAnalyticContinuation<Floating, ComplexFloating>
 {
 public:
 	AnalyticContinuation(CoefficientStorage<ComplexFloating, Floating> const& coefficients, int node, int maximumNumberOfCoefficients);
 
-	void updateWithLastCoefficients();
-	Complex<long double> getResult() const;
+	virtual void updateWithLastCoefficients();
+	virtual void updateWithCoefficients(int coefficientCount);
+	virtual Complex<long double> getResult() const;
 
 private:
 	void updateWithLastCoefficientsOnce();
@@ -0,0 +1,7 @@
+#pragma once
+
+enum AnalyticContinuationMethod
+{
+	AnalyticContinuationMethodWynnEpsilon,
+	AnalyticContinuationMethodViskovatov
+};
\ No newline at end of file
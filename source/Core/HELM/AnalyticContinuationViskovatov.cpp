@@ -0,0 +1,123 @@
+#include "AnalyticContinuationViskovatov.h"
+#include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include "Complex.h"
+#include <vector>
+#include <assert.h>
+#include <algorithm>
+
+using namespace std;
+
+template class AnalyticContinuationViskovatov< long double, Complex<long double> >;
+template class AnalyticContinuationViskovatov< MultiPrecision, Complex<MultiPrecision> >;
+template class AnalyticContinuationViskovatov< DoubleDouble, Complex<DoubleDouble> >;
+template class AnalyticContinuationViskovatov< QuadDouble, Complex<QuadDouble> >;
+template class AnalyticContinuationViskovatov< double, Complex<double> >;
+
+template<typename Floating, typename ComplexFloating>
+AnalyticContinuationViskovatov<Floating, ComplexFloating>::AnalyticContinuationViskovatov(CoefficientStorage<ComplexFloating, Floating> const& coefficients, int node, int maximumNumberOfCoefficients) :
+	_coefficients(coefficients),
+	_node(node),
+	_maximumNumberOfCoefficients(maximumNumberOfCoefficients),
+	_current(maximumNumberOfCoefficients + 1),
+	_previous(maximumNumberOfCoefficients + 1),
+	_fractionCoefficients(maximumNumberOfCoefficients + 1),
+	_depth(0),
+	_degenerated(false),
+	_alreadyProcessed(0)
+{
+	assert(maximumNumberOfCoefficients > 0);
+	assert(node >= 0);
+}
+
+template<typename Floating, typename ComplexFloating>
+void AnalyticContinuationViskovatov<Floating, ComplexFloating>::updateWithLastCoefficients()
+{
+	updateWithCoefficients(_coefficients.getCoefficientCount());
+}
+
+template<typename Floating, typename ComplexFloating>
+void AnalyticContinuationViskovatov<Floating, ComplexFloating>::updateWithCoefficients(int coefficientCount)
+{
+	assert(_alreadyProcessed < _maximumNumberOfCoefficients);
+	assert(coefficientCount <= _coefficients.getCoefficientCount());
+
+	while (_alreadyProcessed < coefficientCount)
+		updateWithLastCoefficientsOnce();
+
+	evaluate();
+}
+
+// the rows of the Viskovatov table are normalized to a leading one, otherwise their magnitude would grow like the Fibonacci numbers;
+// a new coefficient adds one diagonal to the table, which only depends on the previous diagonal
+template<typename Floating, typename ComplexFloating>
+void AnalyticContinuationViskovatov<Floating, ComplexFloating>::updateWithLastCoefficientsOnce()
+{
+	ComplexFloating const& newCoefficient = _coefficients.getCoefficient(_node, _alreadyProcessed);
+	_partialSum += newCoefficient;
+	swap(_previous, _current);
+
+	if (_alreadyProcessed == 0)
+	{
+		_fractionCoefficients[1] = newCoefficient;
+		_current[1] = ComplexFloating(Floating(1));
+		_depth = 1;
+		_degenerated = abs(newCoefficient) == Floating(0);
+	}
+	else if (!_degenerated)
+	{
+		_current[1] = newCoefficient/_fractionCoefficients[1];
+
+		for (auto row = 2; row <= _depth; ++row)
+			_current[row] = ((row == 2 ? ComplexFloating() : _previous[row - 2]) - _current[row - 1])/_fractionCoefficients[row];
+
+		auto leadingCoefficient = (_depth == 1 ? ComplexFloating() : _previous[_depth - 1]) - _current[_depth];
+
+		// the fraction terminates if the leading coefficient of the next row vanishes
+		if (abs(leadingCoefficient) == Floating(0))
+			_degenerated = true;
+		else
+		{
+			++_depth;
+			_fractionCoefficients[_depth] = leadingCoefficient;
+			_current[_depth] = ComplexFloating(Floating(1));
+		}
+	}
+
+	++_alreadyProcessed;
+}
+
+// a vanishing denominator keeps the previous result, instead of aborting the calculation
+template<typename Floating, typename ComplexFloating>
+void AnalyticContinuationViskovatov<Floating, ComplexFloating>::evaluate()
+{
+	if (_degenerated && _depth <= 1)
+	{
+		_result = Complex<long double>(static_cast<long double>(real(_partialSum)), static_cast<long double>(imag(_partialSum)));
+		return;
+	}
+
+	ComplexFloating const one(Floating(1));
+	ComplexFloating quotient(one);
+
+	for (auto row = _depth; row >= 2; --row)
+	{
+		ComplexFloating denominator = one + _fractionCoefficients[row]*quotient;
+
+		if (abs(denominator) == Floating(0))
+			return;
+
+		quotient = one/denominator;
+	}
+
+	ComplexFloating result = _fractionCoefficients[1]*quotient;
+	_result = Complex<long double>(static_cast<long double>(real(result)), static_cast<long double>(imag(result)));
+}
+
+template<typename Floating, typename ComplexFloating>
+Complex<long double> AnalyticContinuationViskovatov<Floating, ComplexFloating>::getResult() const
+{
+	assert(_alreadyProcessed > 0);
+	return _result;
+}
\ No newline at end of file
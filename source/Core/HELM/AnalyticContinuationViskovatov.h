@@ -0,0 +1,34 @@
+#pragma once
+
+#include "IAnalyticContinuation.h"
+#include "CoefficientStorage.h"
+
+// evaluates the continued fraction c0/(1 + g2*s/(1 + g3*s/(1 + ...))) of the voltage series at s = 1, which is the Pade approximant
+// of the highest order for each number of coefficients, while the epsilon algorithm improves only with every second coefficient
+template<typename Floating, typename ComplexFloating>
+class AnalyticContinuationViskovatov : public IAnalyticContinuation<Floating, ComplexFloating>
+{
+public:
+	AnalyticContinuationViskovatov(CoefficientStorage<ComplexFloating, Floating> const& coefficients, int node, int maximumNumberOfCoefficients);
+
+	virtual void updateWithLastCoefficients();
+	virtual void updateWithCoefficients(int coefficientCount);
+	virtual Complex<long double> getResult() const;
+
+private:
+	void updateWithLastCoefficientsOnce();
+	void evaluate();
+
+private:
+	CoefficientStorage<ComplexFloating, Floating> const& _coefficients;
+	const int _node;
+	const int _maximumNumberOfCoefficients;
+	std::vector<ComplexFloating> _current;
+	std::vector<ComplexFloating> _previous;
+	std::vector<ComplexFloating> _fractionCoefficients;
+	int _depth;
+	bool _degenerated;
+	ComplexFloating _partialSum;
+	Complex<long double> _result;
+	int _alreadyProcessed;
+};
\ No newline at end of file
@@ -0,0 +1,595 @@
+#include "Complex.h"
+#include "Vector.h"
+#include "SparseMatrix.h"
+#include "LUDecompositionStable.h"
+#include "LUDecompositionSparse.h"
+#include "Summation.h"
+#include "CalculatorDouble.h"
+#include "CalculatorLongDouble.h"
+#include "CalculatorDoubleDouble.h"
+#include "CalculatorQuadDouble.h"
+#include "CalculatorMulti.h"
+#include "MultiPrecisionScope.h"
+#include "CalculatorRegister.h"
+#include "RelaxedConvolution.h"
+#include "BiCGSTAB.h"
+#include "PreconditionerJacobi.h"
+#include "PreconditionerIncompleteLU.h"
+#include <fstream>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <omp.h>
+
+using namespace std;
+
+template<class Summation>
+double benchmarkSparseMatrixMultiplySummation(SparseMatrix<long double, Complex<long double>> const &A, Vector<long double, Complex<long double>> const &x, Vector<long double, Complex<long double>> &b, int repetitions)
+{
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < repetitions; ++i)
+		A.multiply<Summation>(b, x);
+
+	auto end = chrono::high_resolution_clock::now();
+	return chrono::duration<double>(end - start).count()/repetitions;
+}
+
+template<class Summation>
+double benchmarkVectorDotSummation(Vector<long double, Complex<long double>> const &x, Vector<long double, Complex<long double>> const &y, long double exactResult, double &relativeError)
+{
+	auto start = chrono::high_resolution_clock::now();
+	auto result = x.dot<Summation>(y);
+	auto end = chrono::high_resolution_clock::now();
+	relativeError = static_cast<double>(abs(std::real(result) - exactResult)/abs(exactResult));
+	return chrono::duration<double>(end - start).count();
+}
+
+// the operations of one iteration of BiCGSTAB on vectors
+template<class Floating>
+double benchmarkVectorOperations(int count, int repetitions)
+{
+	Vector<Floating, Complex<Floating>> x(count);
+	Vector<Floating, Complex<Floating>> y(count);
+	Vector<Floating, Complex<Floating>> z(count);
+	Complex<Floating> sum;
+
+	for (auto i = 0; i < count; ++i)
+	{
+		x.set(i, Complex<Floating>(Floating(1.0/(i + 1)), Floating(0.5*sin(i))));
+		y.set(i, Complex<Floating>(Floating(cos(0.3*i)), Floating(-1.0/(i + 2))));
+	}
+
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < repetitions; ++i)
+	{
+		sum += x.dot(y);
+		sum += x.conjugateDot(y);
+		sum += y.squaredNorm();
+		z.weightedSum(x, Complex<Floating>(Floating(0.5)), y);
+		z.addWeightedSum(Complex<Floating>(Floating(0.25)), x, Complex<Floating>(Floating(-0.75)), y);
+	}
+
+	auto end = chrono::high_resolution_clock::now();
+	return std::abs(sum) > 0 ? chrono::duration<double>(end - start).count()/repetitions : -1;
+}
+
+// a feeder with the slack bus in front of the first node and equal loads at all nodes, which are scaled per scenario
+void setUpFeederScenario(ICalculator &calculator, int nodeCount, int scenario, double loadFactor)
+{
+	vector<int> rows;
+	vector<int> columns;
+	vector<double> admittancesReal;
+	vector<double> admittancesImaginary;
+	vector<double> zeros(nodeCount, 0);
+	vector<double> constantCurrentsReal(nodeCount, 0);
+	vector<double> constantCurrentsImaginary(nodeCount, 0);
+	vector<int> pqNodes(nodeCount);
+	vector<double> pqPowersReal(nodeCount, -0.0005*loadFactor);
+	vector<double> pqPowersImaginary(nodeCount, -0.0001*loadFactor);
+	constantCurrentsReal[0] = 100;
+	constantCurrentsImaginary[0] = -100;
+
+	for (auto i = 0; i < nodeCount; ++i)
+	{
+		// the first node is connected to the slack bus instead of a predecessor
+		auto lineCount = i == nodeCount - 1 ? 1 : 2;
+		pqNodes[i] = i;
+
+		if (i > 0)
+		{
+			rows.push_back(i);
+			columns.push_back(i - 1);
+			admittancesReal.push_back(-100);
+			admittancesImaginary.push_back(100);
+		}
+
+		rows.push_back(i);
+		columns.push_back(i);
+		admittancesReal.push_back(100*lineCount);
+		admittancesImaginary.push_back(-100*lineCount);
+
+		if (i < nodeCount - 1)
+		{
+			rows.push_back(i);
+			columns.push_back(i + 1);
+			admittancesReal.push_back(-100);
+			admittancesImaginary.push_back(100);
+		}
+	}
+
+	if (scenario == 0)
+	{
+		calculator.setAdmittances(static_cast<int>(rows.size()), rows.data(), columns.data(), admittancesReal.data(), admittancesImaginary.data());
+		calculator.setAdmittanceRowSums(zeros.data(), zeros.data());
+		calculator.setConstantCurrents(constantCurrentsReal.data(), constantCurrentsImaginary.data());
+	}
+
+	calculator.setPQBusesOfScenario(scenario, pqNodes.data(), pqPowersReal.data(), pqPowersImaginary.data());
+}
+
+// a random tree, in which every node is connected to one of the nodes before it, and a connection to the slack bus at the first node
+SparseMatrix<long double, Complex<long double>> createRadialNetwork(int nodeCount)
+{
+	SparseMatrix<long double, Complex<long double>> admittances(nodeCount, nodeCount);
+	vector<Complex<long double>> diagonal(nodeCount);
+	Complex<long double> lineAdmittance(10, -10);
+	Complex<long double> couplingAdmittance(-10, 10);
+	mt19937 generator(42);
+	diagonal[0] = lineAdmittance;
+
+	for (auto i = 1; i < nodeCount; ++i)
+	{
+		auto parent = uniform_int_distribution<int>(0, i - 1)(generator);
+		admittances.set(i, parent, couplingAdmittance);
+		admittances.set(parent, i, couplingAdmittance);
+		diagonal[i] += lineAdmittance;
+		diagonal[parent] += lineAdmittance;
+	}
+
+	for (auto i = 0; i < nodeCount; ++i)
+		admittances.set(i, i, diagonal[i]);
+
+	return admittances;
+}
+
+extern "C" __declspec(dllexport) double __cdecl BenchmarkSparseMatrixMultiply(bool frozen, int repetitions)
+{
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+
+	if (frozen)
+		A.freeze();
+
+	for (auto i = 0; i < n; ++i)
+		x.set(i, Complex<long double>(i, n - i));
+
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < repetitions; ++i)
+		A.multiply(b, x);
+
+	auto end = chrono::high_resolution_clock::now();
+	return chrono::duration<double>(end - start).count()/repetitions;
+}
+
+extern "C" __declspec(dllexport) double __cdecl BenchmarkLUDecompositionOrdering(int ordering, bool stable, int *nonZeroCount)
+{
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	auto orderingCasted = static_cast<LUDecompositionOrdering>(ordering);
+	LUDecomposition<long double, Complex<long double>> *solver = 0;
+
+	auto start = chrono::high_resolution_clock::now();
+
+	if (stable)
+		solver = new LUDecompositionStable<long double, Complex<long double>>(A, orderingCasted);
+	else
+		solver = new LUDecompositionSparse<long double, Complex<long double>>(A, orderingCasted);
+
+	auto end = chrono::high_resolution_clock::now();
+	*nonZeroCount = solver->getNonZeroCount();
+	delete solver;
+	return chrono::duration<double>(end - start).count();
+}
+
+extern "C" __declspec(dllexport) double __cdecl BenchmarkLUDecomposition(bool numericOnly, int repetitions)
+{
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	LUDecompositionStable<long double, Complex<long double>> solver(A);
+
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < repetitions; ++i)
+		if (numericOnly)
+			solver.refactorize(A);
+		else
+			LUDecompositionStable<long double, Complex<long double>> solverCompletelyNew(A);
+
+	auto end = chrono::high_resolution_clock::now();
+	return chrono::duration<double>(end - start).count()/repetitions;
+}
+
+
+extern "C" __declspec(dllexport) double __cdecl BenchmarkSparseMatrixMultiplySummation(int summation, int repetitions)
+{
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	A.freeze();
+
+	for (auto i = 0; i < n; ++i)
+		x.set(i, Complex<long double>(i, n - i));
+
+	switch (summation)
+	{
+	case 0:
+		return benchmarkSparseMatrixMultiplySummation<SummationNaive<long double>>(A, x, b, repetitions);
+	case 1:
+		return benchmarkSparseMatrixMultiplySummation<SummationNeumaier<long double>>(A, x, b, repetitions);
+	case 2:
+		return benchmarkSparseMatrixMultiplySummation<SummationPairwise<long double>>(A, x, b, repetitions);
+	case 3:
+		return benchmarkSparseMatrixMultiplySummation<SummationSorted<long double>>(A, x, b, repetitions);
+	}
+
+	return -1;
+}
+
+// the summands are exactly representable and cancel each other out pairwise except for small integers,
+// therefore the exact result is known without the need for a higher precision
+extern "C" __declspec(dllexport) double __cdecl BenchmarkVectorDotSummation(int summation, int count, double *relativeError)
+{
+	Vector<long double, Complex<long double>> x(count);
+	Vector<long double, Complex<long double>> y(count);
+	vector<long double> summands;
+	mt19937 generator(42);
+	uniform_int_distribution<int> exponents(0, 60);
+	uniform_int_distribution<int> mantissas(1, 1000);
+	long double exactResult = 0;
+	auto pairCount = count/4;
+	summands.reserve(count);
+
+	for (auto i = 0; i < pairCount; ++i)
+	{
+		auto big = ldexp(static_cast<long double>(mantissas(generator)), exponents(generator));
+		summands.push_back(big);
+		summands.push_back((-1)*big);
+	}
+
+	for (auto i = 2*pairCount; i < count; ++i)
+	{
+		auto small = static_cast<long double>(mantissas(generator));
+		summands.push_back(small);
+		exactResult += small;
+	}
+
+	shuffle(summands.begin(), summands.end(), generator);
+
+	for (auto i = 0; i < count; ++i)
+	{
+		x.set(i, Complex<long double>(summands[i], 0));
+		y.set(i, Complex<long double>(1, 0));
+	}
+
+	switch (summation)
+	{
+	case 0:
+		return benchmarkVectorDotSummation<SummationNaive<long double>>(x, y, exactResult, *relativeError);
+	case 1:
+		return benchmarkVectorDotSummation<SummationNeumaier<long double>>(x, y, exactResult, *relativeError);
+	case 2:
+		return benchmarkVectorDotSummation<SummationPairwise<long double>>(x, y, exactResult, *relativeError);
+	case 3:
+		return benchmarkVectorDotSummation<SummationSorted<long double>>(x, y, exactResult, *relativeError);
+	}
+
+	return -1;
+}
+
+// returns the throughput in scenarios per second, either of one batch calculator or of one calculator per scenario
+extern "C" __declspec(dllexport) double __cdecl BenchmarkBatchCalculation(int nodeCount, int scenarioCount, bool batched)
+{
+	auto start = chrono::high_resolution_clock::now();
+
+	if (batched)
+	{
+		CalculatorLongDouble calculator(1e-8, 50, nodeCount, nodeCount, 0, 1, scenarioCount, false);
+
+		for (auto scenario = 0; scenario < scenarioCount; ++scenario)
+			setUpFeederScenario(calculator, nodeCount, scenario, 0.5 + static_cast<double>(scenario)/scenarioCount);
+
+		calculator.calculate();
+	}
+	else
+		for (auto scenario = 0; scenario < scenarioCount; ++scenario)
+		{
+			CalculatorLongDouble calculator(1e-8, 50, nodeCount, nodeCount, 0, 1, false);
+			setUpFeederScenario(calculator, nodeCount, 0, 0.5 + static_cast<double>(scenario)/scenarioCount);
+			calculator.calculate();
+		}
+
+	auto end = chrono::high_resolution_clock::now();
+	return scenarioCount/chrono::duration<double>(end - start).count();
+}
+
+// returns the time for one forward and backward substitution including the iterative refinement
+extern "C" __declspec(dllexport) double __cdecl BenchmarkLUSubstitution(bool meshed, int threadCount, int repetitions, int *levelCount)
+{
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+
+	if (meshed)
+	{
+		fstream file("testdata\\matrix.csv", ios_base::in);
+		file >> A;
+	}
+	else
+		A = createRadialNetwork(n);
+
+	LUDecompositionStable<long double, Complex<long double>> solver(A);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+	*levelCount = solver.getForwardLevelCount() + solver.getBackwardLevelCount();
+
+	for (auto i = 0; i < n; ++i)
+		x.set(i, Complex<long double>(i, n - i));
+
+	A.multiply(b, x);
+	auto previousThreadCount = omp_get_max_threads();
+	omp_set_num_threads(threadCount);
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < repetitions; ++i)
+		solver.solve(b);
+
+	auto end = chrono::high_resolution_clock::now();
+	omp_set_num_threads(previousThreadCount);
+	return chrono::duration<double>(end - start).count()/repetitions;
+}
+
+// returns the time for one calculation with the floating point type selected by its index, the MPIR types with 128 and 256 bits, and double at last
+extern "C" __declspec(dllexport) double __cdecl BenchmarkCalculatorPrecision(int floatingType, int nodeCount, double *relativePowerError)
+{
+	ICalculator *calculator = 0;
+
+	switch (floatingType)
+	{
+	case 0:
+		calculator = new CalculatorLongDouble(1e-20, 80, nodeCount, nodeCount, 0, 1, false);
+		break;
+	case 1:
+		calculator = new CalculatorDoubleDouble(1e-20, 80, nodeCount, nodeCount, 0, 1, false);
+		break;
+	case 2:
+		calculator = new CalculatorQuadDouble(1e-20, 80, nodeCount, nodeCount, 0, 1, false);
+		break;
+	case 3:
+		calculator = new CalculatorMulti(1e-20, 80, nodeCount, nodeCount, 0, 1, 128, false);
+		break;
+	case 4:
+		calculator = new CalculatorMulti(1e-20, 80, nodeCount, nodeCount, 0, 1, 256, false);
+		break;
+	case 5:
+		calculator = new CalculatorDouble(1e-20, 80, nodeCount, nodeCount, 0, 1, false);
+		break;
+	default:
+		return -1;
+	}
+
+	setUpFeederScenario(*calculator, nodeCount, 0, 1);
+	auto start = chrono::high_resolution_clock::now();
+	calculator->calculate();
+	auto end = chrono::high_resolution_clock::now();
+	*relativePowerError = calculator->getRelativePowerError();
+	delete calculator;
+	return chrono::duration<double>(end - start).count();
+}
+// returns the time for a convolution of MultiPrecision coefficients, either with the generic operators or the fused kernels
+extern "C" __declspec(dllexport) double __cdecl BenchmarkMultiPrecisionConvolution(bool fused, int count, long long *allocationCount)
+{
+	MultiPrecisionScope scope(256);
+	std::vector<Complex<MultiPrecision>> first;
+	std::vector<Complex<MultiPrecision>> second;
+	Complex<MultiPrecision> result;
+
+	for (auto i = 0; i < count; ++i)
+	{
+		first.push_back(Complex<MultiPrecision>(MultiPrecision(1.0/(i + 1)), MultiPrecision(0.5/(i + 2))));
+		second.push_back(Complex<MultiPrecision>(MultiPrecision(0.3*i), MultiPrecision(-1.0/(i + 3))));
+	}
+
+	result.addProduct(first[0], second[0]);
+	result = Complex<MultiPrecision>();
+	MultiPrecision::startAllocationCounting();
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto n = 0; n < count; ++n)
+		for (auto i = 0; i <= n; ++i)
+			if (fused)
+				result.addProduct(first[i], second[n - i]);
+			else
+				result += first[i]*second[n - i];
+
+	auto end = chrono::high_resolution_clock::now();
+	*allocationCount = MultiPrecision::getAllocationCount();
+	MultiPrecision::stopAllocationCounting();
+	return chrono::duration<double>(end - start).count();
+}
+
+// returns the throughput in calculations per second of independent calculators, either one after another or on the workers of the register
+extern "C" __declspec(dllexport) double __cdecl BenchmarkCalculatorThroughput(int nodeCount, int calculationCount, bool concurrent)
+{
+	CalculatorRegister calculatorRegister;
+	vector<int> calculators(calculationCount);
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < calculationCount; ++i)
+	{
+		calculators[i] = calculatorRegister.createCalculatorLongDouble(1e-8, 50, nodeCount, nodeCount, 0, 1, false);
+		setUpFeederScenario(calculatorRegister.get(calculators[i]), nodeCount, 0, 0.5 + static_cast<double>(i)/calculationCount);
+
+		if (concurrent)
+			calculatorRegister.calculateAsync(calculators[i], 0);
+		else
+			calculatorRegister.get(calculators[i]).calculate();
+	}
+
+	for (auto i = 0; i < calculationCount; ++i)
+	{
+		calculatorRegister.wait(calculators[i]);
+		calculatorRegister.remove(calculators[i]);
+	}
+
+	auto end = chrono::high_resolution_clock::now();
+	return calculationCount/chrono::duration<double>(end - start).count();
+}
+
+// returns the number of coefficients until the calculation of a feeder, which is loaded more heavily with a higher load factor, terminated
+extern "C" __declspec(dllexport) int __cdecl BenchmarkAnalyticContinuation(int method, int nodeCount, double loadFactor, double *relativePowerError)
+{
+	CalculatorLongDouble calculator(1e-8, 120, nodeCount, nodeCount, 0, 1, false);
+	setUpFeederScenario(calculator, nodeCount, 0, loadFactor);
+	calculator.setAnalyticContinuationMethod(static_cast<AnalyticContinuationMethod>(method));
+	calculator.calculate();
+	*relativePowerError = calculator.getRelativePowerError();
+	return calculator.getCoefficientCount();
+}
+
+// returns the time for the online calculation of the inverse of a MultiPrecision series, either with the direct or the relaxed convolution
+extern "C" __declspec(dllexport) double __cdecl BenchmarkRelaxedConvolution(bool relaxed, int count, double *relativeError)
+{
+	MultiPrecisionScope scope(256);
+	std::vector<Complex<MultiPrecision>> coefficients;
+	std::vector<Complex<MultiPrecision>> inverseCoefficients(count);
+	RelaxedConvolution<Complex<MultiPrecision>, MultiPrecision> convolution(count, 1);
+
+	// the divisions ensure, that all digits of the coefficients are used, like for the ones of a calculation
+	for (auto i = 0; i < count; ++i)
+	{
+		auto magnitude = pow(0.8, i);
+		coefficients.push_back(Complex<MultiPrecision>(MultiPrecision(magnitude*cos(0.7*i))/MultiPrecision(3), MultiPrecision(magnitude*sin(1.3*i))/MultiPrecision(7)));
+	}
+
+	auto start = chrono::high_resolution_clock::now();
+	inverseCoefficients[0] = Complex<MultiPrecision>(MultiPrecision(1))/coefficients[0];
+
+	for (auto n = 1; n < count; ++n)
+	{
+		Complex<MultiPrecision> sum;
+
+		if (relaxed)
+			sum = convolution.calculateNextCoefficient(0, n, &coefficients[0], 1, &inverseCoefficients[0], 1);
+		else
+			for (auto i = 1; i <= n; ++i)
+				sum.addProduct(coefficients[i], inverseCoefficients[n - i]);
+
+		inverseCoefficients[n] = sum/coefficients[0]*Complex<MultiPrecision>(MultiPrecision(-1));
+	}
+
+	auto end = chrono::high_resolution_clock::now();
+	Complex<MultiPrecision> product;
+	double magnitude = 0;
+
+	for (auto i = 0; i < count; ++i)
+	{
+		product.addProduct(coefficients[i], inverseCoefficients[count - 1 - i]);
+		magnitude += static_cast<double>(std::abs(coefficients[i])*std::abs(inverseCoefficients[count - 1 - i]));
+	}
+
+	*relativeError = static_cast<double>(std::abs(product))/magnitude;
+	return chrono::duration<double>(end - start).count();
+}
+
+// returns the time for one solution of the meshed network with BiCGSTAB and the preconditioner selected by its index, the setup of the preconditioner separately
+extern "C" __declspec(dllexport) double __cdecl BenchmarkBiCGSTABPreconditioner(int preconditioner, int repetitions, int *iterationCount, double *setupTime)
+{
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	A.freeze();
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+
+	for (auto i = 0; i < n; ++i)
+		x.set(i, Complex<long double>(i, n - i));
+
+	A.multiply(b, x);
+	auto setupStart = chrono::high_resolution_clock::now();
+	IPreconditioner<long double, Complex<long double>> *selectedPreconditioner = 0;
+
+	switch (preconditioner)
+	{
+	case BiCGSTABPreconditionerJacobi:
+		selectedPreconditioner = new PreconditionerJacobi<long double, Complex<long double>>(A);
+		break;
+	case BiCGSTABPreconditionerIncompleteLU:
+		selectedPreconditioner = new PreconditionerIncompleteLU<long double, Complex<long double>>(A);
+		break;
+	case BiCGSTABPreconditionerIncompleteLUThreshold:
+		selectedPreconditioner = new PreconditionerIncompleteLU<long double, Complex<long double>>(A, 1e-8, 50);
+		break;
+	}
+
+	BiCGSTAB<long double, Complex<long double>> solver(A, 1e-10, selectedPreconditioner);
+	auto setupEnd = chrono::high_resolution_clock::now();
+	*setupTime = chrono::duration<double>(setupEnd - setupStart).count();
+	auto start = chrono::high_resolution_clock::now();
+
+	for (auto i = 0; i < repetitions; ++i)
+		solver.solve(b, *iterationCount);
+
+	auto end = chrono::high_resolution_clock::now();
+	return chrono::duration<double>(end - start).count()/repetitions;
+}
+
+// returns the time for a calculation of a feeder with the iterative solver, which starts from the previous solutions if the history length is positive
+extern "C" __declspec(dllexport) double __cdecl BenchmarkSolutionHistory(int historyLength, int nodeCount, double *relativePowerError)
+{
+	CalculatorLongDouble calculator(1e-8, 60, nodeCount, nodeCount, 0, 1, true);
+	setUpFeederScenario(calculator, nodeCount, 0, 1);
+	calculator.setSolutionHistoryLength(historyLength);
+	auto start = chrono::high_resolution_clock::now();
+	calculator.calculate();
+	auto end = chrono::high_resolution_clock::now();
+	*relativePowerError = calculator.getRelativePowerError();
+	return chrono::duration<double>(end - start).count();
+}
+
+// returns the time for a complete decomposition of a radial grid, which should grow with the fill-in and not with the square of the node count
+extern "C" __declspec(dllexport) double __cdecl BenchmarkLUDecompositionRadial(int nodeCount, bool stable)
+{
+	auto A = createRadialNetwork(nodeCount);
+	auto start = chrono::high_resolution_clock::now();
+
+	if (stable)
+		LUDecompositionStable<long double, Complex<long double>> solver(A);
+	else
+		LUDecompositionSparse<long double, Complex<long double>> solver(A);
+
+	auto end = chrono::high_resolution_clock::now();
+	return chrono::duration<double>(end - start).count();
+}
+
+// returns the time for the vector operations of one iteration of BiCGSTAB, either with double and its vectorized kernels or with long double
+extern "C" __declspec(dllexport) double __cdecl BenchmarkVectorOperationsDouble(bool useDouble, int count, int repetitions)
+{
+	if (useDouble)
+		return benchmarkVectorOperations<double>(count, repetitions);
+
+	return benchmarkVectorOperations<long double>(count, repetitions);
+}
\ No newline at end of file
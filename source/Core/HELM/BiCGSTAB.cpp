@@ -1,74 +1,170 @@
 #include "BiCGSTAB.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "NumericalTraits.h"
+#include "PreconditionerJacobi.h"
 #include <assert.h>
 #include <algorithm>
 
 template class BiCGSTAB<long double, Complex<long double>>;
 template class BiCGSTAB<MultiPrecision, Complex<MultiPrecision>>;
+template class BiCGSTAB<DoubleDouble, Complex<DoubleDouble>>;
+template class BiCGSTAB<QuadDouble, Complex<QuadDouble>>;
+template class BiCGSTAB<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
 BiCGSTAB<Floating, ComplexFloating>::BiCGSTAB(const SparseMatrix<Floating, ComplexFloating> &systemMatrix, Floating epsilon) :
+	BiCGSTAB(systemMatrix, epsilon, new PreconditionerJacobi<Floating, ComplexFloating>(systemMatrix))
+{ }
+
+template<class Floating, class ComplexFloating>
+BiCGSTAB<Floating, ComplexFloating>::BiCGSTAB(const SparseMatrix<Floating, ComplexFloating> &systemMatrix, Floating epsilon, IPreconditioner<Floating, ComplexFloating> *preconditioner) :
 	_dimension(systemMatrix.getRowCount()),
+	_epsilon(std::max(epsilon, NumericalTraits<Floating>::epsilon())),
 	_systemMatrix(systemMatrix),
-	_preconditioner(_systemMatrix.getRowCount(), _systemMatrix.getColumnCount())
+	_preconditioner(preconditioner),
+	_residual(_dimension),
+	_firstResidual(_dimension),
+	_temp(_dimension),
+	_v(_dimension),
+	_p(_dimension),
+	_y(_dimension),
+	_z(_dimension),
+	_s(_dimension),
+	_t(_dimension),
+	_remainder(_dimension),
+	_partialSolution(_dimension)
 {
 	assert(_systemMatrix.getRowCount() == _systemMatrix.getColumnCount());
+	assert(_preconditioner != 0);
+}
+
+template<class Floating, class ComplexFloating>
+BiCGSTAB<Floating, ComplexFloating>::~BiCGSTAB()
+{
+	delete _preconditioner;
+	_preconditioner = 0;
+}
+
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> BiCGSTAB<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b) const
+{
+	int iterationCount;
+	return solve(b, iterationCount);
+}
+
+template<class Floating, class ComplexFloating>
+void BiCGSTAB<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const
+{
+	int iterationCount;
+	_preconditioner->apply(x, b);
+	solveInternal(b, x, 0, iterationCount);
+}
+
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> BiCGSTAB<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b, int &iterationCount) const
+{
+	Vector<Floating, ComplexFloating> x(_dimension);
+	_preconditioner->apply(x, b);
+	solveInternal(b, x, 0, iterationCount);
+	return x;
+}
+
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> BiCGSTAB<Floating, ComplexFloating>::solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history) const
+{
+	int iterationCount;
+	return solveWithHistory(b, history, iterationCount);
+}
 
-	for (auto i = 0; i < _dimension; ++i)
+template<class Floating, class ComplexFloating>
+void BiCGSTAB<Floating, ComplexFloating>::solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, Vector<Floating, ComplexFloating> &x) const
+{
+	int iterationCount;
+	solveWithHistory(b, history, x, iterationCount);
+}
+
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> BiCGSTAB<Floating, ComplexFloating>::solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, int &iterationCount) const
+{
+	Vector<Floating, ComplexFloating> x(_dimension);
+	solveWithHistory(b, history, x, iterationCount);
+	return x;
+}
+
+// the previous solutions give the initial guess and deflate the preconditioner
+template<class Floating, class ComplexFloating>
+void BiCGSTAB<Floating, ComplexFloating>::solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, Vector<Floating, ComplexFloating> &x, int &iterationCount) const
+{
+	if (history.getLength() == 0)
 	{
-		ComplexFloating const &diagonalValue = _systemMatrix(i, i);
-		_preconditioner.set(i, i, ComplexFloating(Floating(1))/diagonalValue);
+		_preconditioner->apply(x, b);
+		solveInternal(b, x, 0, iterationCount);
+		return;
 	}
+
+	history.calculateInitialGuess(b, x);
+	solveInternal(b, x, &history, iterationCount);
 }
 
+// starts with the initial guess in x, the iteration count includes the ones before the last restart
 template<class Floating, class ComplexFloating>
-Vector<Floating, ComplexFloating> BiCGSTAB<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b) const
+void BiCGSTAB<Floating, ComplexFloating>::solveInternal(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x, SolutionHistory<Floating, ComplexFloating> const *history, int &iterationCount) const
 {	
 	assert(b.isFinite());
+	assert(x.getCount() == _dimension);
 
-	Vector<Floating, ComplexFloating> x(_dimension);
-	_preconditioner.multiply(x, b);
+	iterationCount = 0;
 	
 	assert(x.isFinite());
 
 	auto maximumIterations = std::max(2*_dimension, 100);
-	Vector<Floating, ComplexFloating> residual(_dimension);
-	Vector<Floating, ComplexFloating> temp(_dimension); 
+	auto &residual = _residual;
+	auto &firstResidual = _firstResidual;
+	auto &temp = _temp;
 	_systemMatrix.multiply(temp, x);
 	residual.subtract(b, temp);
-	auto firstResidual = residual;  
-	auto firstResidualSquaredNorm = std::abs(firstResidual.squaredNorm());
-	auto rhsSquaredNorm = b.squaredNorm();
-	auto epsilon = NumericalTraits<Floating>::epsilon();
-	auto epsilonSquared = epsilon*epsilon;
+	firstResidual = residual;  
+	auto firstResidualSquaredNorm = std::real(firstResidual.conjugateDot(firstResidual));
+	auto rhsSquaredNorm = std::real(b.conjugateDot(b));
+	auto epsilonSquared = _epsilon*_epsilon;
+	auto machineEpsilon = NumericalTraits<Floating>::epsilon();
 	auto i = 0;
 	auto restarts = 0;
 	auto rho = ComplexFloating(Floating(1));
 	auto alpha = ComplexFloating(Floating(1));
 	auto w = ComplexFloating(Floating(1));  
-	auto v = Vector<Floating, ComplexFloating>(_dimension);
-	auto p = Vector<Floating, ComplexFloating>(_dimension);
-	auto y = Vector<Floating, ComplexFloating>(_dimension);
-	auto z = Vector<Floating, ComplexFloating>(_dimension);
-	auto kt = Vector<Floating, ComplexFloating>(_dimension);
-	auto ks = Vector<Floating, ComplexFloating>(_dimension);
-	auto s = Vector<Floating, ComplexFloating>(_dimension);
-	auto t = Vector<Floating, ComplexFloating>(_dimension);
-
-	if(std::abs(rhsSquaredNorm) == Floating(0))
-		return b;	
-
-	while (std::abs(residual.squaredNorm()/rhsSquaredNorm) > epsilonSquared && i < maximumIterations)
+	auto &v = _v;
+	auto &p = _p;
+	auto &y = _y;
+	auto &z = _z;
+	auto &s = _s;
+	auto &t = _t;
+	// the workspaces are kept between the solves, but only v and p are read before they are written
+	v.setToZero();
+	p.setToZero();
+
+	if(rhsSquaredNorm == Floating(0))
+	{
+		x = b;
+		return;
+	}
+
+	// the inner products have to be conjugated for complex values, otherwise the steps do not minimize the residual
+	while (std::real(residual.conjugateDot(residual))/rhsSquaredNorm > epsilonSquared && i < maximumIterations)
 	{
 		auto rho_old = rho;
-		rho = firstResidual.dot(residual);
+		rho = firstResidual.conjugateDot(residual);
 
-		if (std::abs(std::abs(rho) - firstResidualSquaredNorm) < Floating(1e-20))
+		// the shadow residual is almost orthogonal to the residual, therefore the iteration has to be restarted
+		if (std::abs(rho) < machineEpsilon*machineEpsilon*firstResidualSquaredNorm)
 		{
+			_systemMatrix.multiply(temp, x);
+			residual.subtract(b, temp);
 			firstResidual = residual;
-			firstResidualSquaredNorm = std::abs(residual.squaredNorm());
+			firstResidualSquaredNorm = std::real(residual.conjugateDot(residual));
 			rho = ComplexFloating(firstResidualSquaredNorm);
 			i = 0;
 			++restarts;
@@ -80,26 +176,41 @@ Vector<Floating, ComplexFloating> BiCGSTAB<Floating, ComplexFloating>::solve(con
 		auto beta = (rho/rho_old)*(alpha/w);
 		temp.weightedSum(p, w*ComplexFloating(Floating(-1)), v);
 		p.weightedSum(residual, beta, temp);
-		_preconditioner.multiply(y, p);
+		applyPreconditioner(y, p, history);
 		_systemMatrix.multiply(v, y);
-		alpha = rho / firstResidual.dot(v);
+		alpha = rho / firstResidual.conjugateDot(v);
 		s.weightedSum(residual, alpha*ComplexFloating(Floating(-1)), v);
-		_preconditioner.multiply(z, s);
+		applyPreconditioner(z, s, history);
 		_systemMatrix.multiply(t, z);
 
-		auto tmp = std::abs(t.squaredNorm());
+		auto tmp = std::real(t.conjugateDot(t));
 		if(tmp > Floating(0))
-			w = t.dot(s) / ComplexFloating(tmp);
+			w = t.conjugateDot(s) / ComplexFloating(tmp);
 		else
 			w = ComplexFloating(Floating(0));
 
 		x.addWeightedSum(alpha, y, w, z);
 		residual.weightedSum(s, w*ComplexFloating(Floating(-1)), t);
 		++i;
+		++iterationCount;
 	}
 
 	if (!x.isFinite())
 		throw overflow_error("BiCGSTAB did not converge to a proper value");
+}
 
-	return x;
+// the part of the source within the previous right hand sides is solved with the previous solutions, and only the remainder
+// goes through the preconditioner, which keeps the slowly converging components, which the previous solves found, out of the iteration
+template<class Floating, class ComplexFloating>
+void BiCGSTAB<Floating, ComplexFloating>::applyPreconditioner(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source, SolutionHistory<Floating, ComplexFloating> const *history) const
+{
+	if (history == 0)
+	{
+		_preconditioner->apply(destination, source);
+		return;
+	}
+
+	history->calculatePartialSolution(source, _remainder, _partialSolution);
+	_preconditioner->apply(destination, _remainder);
+	destination.add(destination, _partialSolution);
 }
\ No newline at end of file
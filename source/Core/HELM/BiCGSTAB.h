@@ -3,18 +3,49 @@
 #include "SparseMatrix.h"
 #include "Vector.h"
 #include "ILinearEquationSystemSolver.h"
+#include "IPreconditioner.h"
 
 template<class Floating, class ComplexFloating>
 class BiCGSTAB : public ILinearEquationSystemSolver<Floating, ComplexFloating>
 {
 public:
+	// the iteration stops once the residual relative to the right hand side is below epsilon, but never before it reaches the machine epsilon
 	BiCGSTAB(const SparseMatrix<Floating, ComplexFloating> &systemMatrix, Floating epsilon);
+	// takes the ownership of the preconditioner
+	BiCGSTAB(const SparseMatrix<Floating, ComplexFloating> &systemMatrix, Floating epsilon, IPreconditioner<Floating, ComplexFloating> *preconditioner);
+	virtual ~BiCGSTAB();
 
 	virtual Vector<Floating, ComplexFloating> solve(const Vector<Floating, ComplexFloating> &b) const;
+	virtual void solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const;
+	Vector<Floating, ComplexFloating> solve(const Vector<Floating, ComplexFloating> &b, int &iterationCount) const;
+	virtual Vector<Floating, ComplexFloating> solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history) const;
+	virtual void solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, Vector<Floating, ComplexFloating> &x) const;
+	Vector<Floating, ComplexFloating> solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, int &iterationCount) const;
+
+private:
+	void solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, Vector<Floating, ComplexFloating> &x, int &iterationCount) const;
+	void solveInternal(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x, SolutionHistory<Floating, ComplexFloating> const *history, int &iterationCount) const;
+	void applyPreconditioner(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source, SolutionHistory<Floating, ComplexFloating> const *history) const;
 
 private:	
 	const int _dimension;
+	const Floating _epsilon;
 	SparseMatrix<Floating, ComplexFloating> const &_systemMatrix;
-	SparseMatrix<Floating, ComplexFloating> _preconditioner;
+	IPreconditioner<Floating, ComplexFloating> *_preconditioner;
+	mutable Vector<Floating, ComplexFloating> _residual;
+	mutable Vector<Floating, ComplexFloating> _firstResidual;
+	mutable Vector<Floating, ComplexFloating> _temp;
+	mutable Vector<Floating, ComplexFloating> _v;
+	mutable Vector<Floating, ComplexFloating> _p;
+	mutable Vector<Floating, ComplexFloating> _y;
+	mutable Vector<Floating, ComplexFloating> _z;
+	mutable Vector<Floating, ComplexFloating> _s;
+	mutable Vector<Floating, ComplexFloating> _t;
+	mutable Vector<Floating, ComplexFloating> _remainder;
+	mutable Vector<Floating, ComplexFloating> _partialSolution;
+
+private:
+	BiCGSTAB(BiCGSTAB const &rhs);
+	void operator=(BiCGSTAB const &rhs);
 };
 
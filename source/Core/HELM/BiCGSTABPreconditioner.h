@@ -0,0 +1,8 @@
+#pragma once
+
+enum BiCGSTABPreconditioner
+{
+	BiCGSTABPreconditionerJacobi,
+	BiCGSTABPreconditionerIncompleteLU,
+	BiCGSTABPreconditionerIncompleteLUThreshold
+};
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "CalculationJob.h"
+#include "ICalculator.h"
+#include <exception>
+#include <omp.h>
+
+using namespace std;
+
+CalculationJob::CalculationJob(ICalculator &calculator, int calculatorId, CompletionCallback completionCallback) :
+	_calculator(calculator),
+	_calculatorId(calculatorId),
+	_completionCallback(completionCallback),
+	_state(CalculationStateQueued)
+{ }
+
+// many small calculations run concurrently on the workers, therefore only the big ones use the parallel loops,
+// the setting belongs to the thread of the worker and must be renewed for each job
+void CalculationJob::run()
+{
+	if (_cancellationToken.isCancellationRequested())
+	{
+		complete(CalculationStateCancelled);
+		return;
+	}
+
+	omp_set_num_threads(_calculator.getNodeCount() < _minimumParallelNodeCount ? 1 : omp_get_num_procs());
+	setState(CalculationStateRunning);
+	auto state = CalculationStateFinished;
+
+	try
+	{
+		if (_calculator.calculate(_cancellationToken))
+			state = CalculationStateCancelled;
+	}
+	catch(exception)
+	{
+		state = CalculationStateFailed;
+	}
+
+	complete(state);
+}
+
+void CalculationJob::cancel()
+{
+	_cancellationToken.cancel();
+}
+
+CalculationState CalculationJob::wait()
+{
+	unique_lock<mutex> lock(_mutex);
+
+	while (!isFinal(_state))
+		_stateChanged.wait(lock);
+
+	return _state;
+}
+
+CalculationState CalculationJob::getState()
+{
+	lock_guard<mutex> lock(_mutex);
+	return _state;
+}
+
+bool CalculationJob::isFinal(CalculationState state)
+{
+	return state == CalculationStateFinished || state == CalculationStateCancelled || state == CalculationStateFailed;
+}
+
+void CalculationJob::setState(CalculationState state)
+{
+	lock_guard<mutex> lock(_mutex);
+	_state = state;
+}
+
+// as soon as the waiting threads are notified the job might be deleted, therefore the callback may only use copies of the members
+void CalculationJob::complete(CalculationState state)
+{
+	auto completionCallback = _completionCallback;
+	auto calculatorId = _calculatorId;
+
+	{
+		lock_guard<mutex> lock(_mutex);
+		_state = state;
+		_stateChanged.notify_all();
+	}
+
+	if (completionCallback != 0)
+		completionCallback(calculatorId, state);
+}
\ No newline at end of file
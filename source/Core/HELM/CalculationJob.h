@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CalculationState.h"
+#include "CancellationToken.h"
+#include "CompletionCallback.h"
+#include <mutex>
+#include <condition_variable>
+
+class ICalculator;
+
+// one asynchronous run of a calculator, the owner must not delete the job before it reached a final state
+class CalculationJob
+{
+public:
+	CalculationJob(ICalculator &calculator, int calculatorId, CompletionCallback completionCallback);
+
+	void run();
+	void cancel();
+	CalculationState wait();
+	CalculationState getState();
+
+public:
+	static bool isFinal(CalculationState state);
+
+private:
+	static const int _minimumParallelNodeCount = 1000;
+
+private:
+	CalculationJob(CalculationJob const &rhs);
+	void operator=(CalculationJob const &rhs);
+
+	void setState(CalculationState state);
+	void complete(CalculationState state);
+
+private:
+	ICalculator &_calculator;
+	const int _calculatorId;
+	const CompletionCallback _completionCallback;
+	CancellationToken _cancellationToken;
+	CalculationState _state;
+	std::mutex _mutex;
+	std::condition_variable _stateChanged;
+};
\ No newline at end of file
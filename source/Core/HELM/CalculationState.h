@@ -0,0 +1,11 @@
+#pragma once
+
+enum CalculationState
+{
+	CalculationStateIdle,
+	CalculationStateQueued,
+	CalculationStateRunning,
+	CalculationStateFinished,
+	CalculationStateCancelled,
+	CalculationStateFailed
+};
\ No newline at end of file
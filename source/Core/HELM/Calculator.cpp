@@ -1,55 +1,93 @@
 #include "Calculator.h"
 #include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "Complex.h"
 #include "BiCGSTAB.h"
 #include "SOR.h"
 #include "LUDecompositionStable.h"
 #include "NumericalTraits.h"
+#include "AnalyticContinuation.h"
+#include "AnalyticContinuationViskovatov.h"
+#include "PreconditionerJacobi.h"
+#include "PreconditionerIncompleteLU.h"
 #include <sstream>
-#include <map>
+#include <algorithm>
 #include <cmath>
 #include <stdexcept>
+#include <utility>
 #include <assert.h>
 
 using namespace std;
 
 template class Calculator<long double, Complex<long double> >;
 template class Calculator<MultiPrecision, Complex<MultiPrecision> >;
+template class Calculator<DoubleDouble, Complex<DoubleDouble> >;
+template class Calculator<QuadDouble, Complex<QuadDouble> >;
+template class Calculator<double, Complex<double> >;
 
 template<typename Floating, typename ComplexFloating>
 Calculator<Floating, ComplexFloating>::Calculator(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver) :
+	Calculator(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, 1, iterativeSolver)
+{ }
+
+template<typename Floating, typename ComplexFloating>
+Calculator<Floating, ComplexFloating>::Calculator(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver) :
 	_targetPrecision(targetPrecision),
 	_numberOfCoefficients(numberOfCoefficients),
 	_nodeCount(nodeCount),
 	_pqBusCount(pqBusCount),
 	_pvBusCount(pvBusCount),
 	_nominalVoltage(nominalVoltage),
+	_scenarioCount(scenarioCount),
 	_iterativeSolver(iterativeSolver),
 	_admittances(nodeCount, nodeCount),
 	_solver(0),
+	_luSymbolic(0),
 	_totalAdmittanceRowSums(nodeCount),
 	_constantCurrents(nodeCount),
-	_pqBuses(pqBusCount, PQBus()),
-	_pvBuses(pvBusCount, PVBus()),
-	_voltages(nodeCount),
-	_coefficientStorage(0),
+	_pqBuses(scenarioCount, vector<PQBus>(pqBusCount, PQBus())),
+	_pvBuses(scenarioCount, vector<PVBus>(pvBusCount, PVBus())),
+	_voltages(scenarioCount, vector< Complex<long double> >(nodeCount)),
+	_bestVoltages(scenarioCount, vector< Complex<long double> >(nodeCount)),
+	_errorHistories(scenarioCount),
+	_continuations(scenarioCount),
+	_powerErrorCurrents(nodeCount),
+	_powerErrorVoltages(nodeCount),
+	_powerErrorPowers(nodeCount),
 	_embeddingModification(Floating(0), Floating(0)),
+	_continuationInterval(1),
+	_analyticContinuationMethod(AnalyticContinuationMethodWynnEpsilon),
+	_preconditioner(BiCGSTABPreconditionerJacobi),
+	_solutionHistoryLength(0),
+	_iterativeSolverTolerance(0),
+	_isSentinel(nodeCount, false),
+	_isContinued(nodeCount, true),
 	_progress(0),
 	_relativePowerError(1),
-	_maximumPossibleCoefficientCount(-1)
+	_relativePowerErrors(scenarioCount, 1),
+	_maximumPossibleCoefficientCount(-1),
+	_progressCallback(0),
+	_progressCallbackCalculatorId(-1)
 { 
 	assert(numberOfCoefficients > 0);
 	assert(nodeCount > 0);
 	assert(pqBusCount >= 0);
 	assert(pvBusCount >= 0);
 	assert(nominalVoltage > 0);
-	_continuations.reserve(nodeCount);
+	assert(scenarioCount > 0);
+
+	for (auto &continuations : _continuations)
+		continuations.reserve(nodeCount);
 }
 
 template<typename Floating, typename ComplexFloating>
 Calculator<Floating, ComplexFloating>::~Calculator()
 {
 	freeMemory();
+	delete _luSymbolic;
+	_luSymbolic = 0;
 }
 
 template<typename Floating, typename ComplexFloating>
@@ -57,6 +95,7 @@ void Calculator<Floating, ComplexFloating>::setAdmittance(int row, int column, C
 {
 	auto valueCasted = createComplexFloating(value);
 	assert(isValueFinite(std::abs2(valueCasted)));
+	_admittances.unfreeze();
 	_admittances.set(row, column, valueCasted);
 }
 
@@ -72,7 +111,9 @@ template<typename Floating, typename ComplexFloating>
 void Calculator<Floating, ComplexFloating>::setPQBus(int busId, int node, Complex<long double> power)
 {
 	assert(isValueFinite(std::abs2(power)));
-	_pqBuses[busId] = PQBus(node, power);
+
+	for (auto &buses : _pqBuses)
+		buses[busId] = PQBus(node, power);
 }
 
 template<typename Floating, typename ComplexFloating>
@@ -80,7 +121,9 @@ void Calculator<Floating, ComplexFloating>::setPVBus(int busId, int node, double
 {
 	assert(isValueFinite(powerReal));
 	assert(isValueFinite(voltageMagnitude));
-	_pvBuses[busId] = PVBus(node, powerReal, voltageMagnitude);
+
+	for (auto &buses : _pvBuses)
+		buses[busId] = PVBus(node, powerReal, voltageMagnitude);
 }
 
 template<typename Floating, typename ComplexFloating>
@@ -91,8 +134,162 @@ void Calculator<Floating, ComplexFloating>::setConstantCurrent(int node, Complex
 	_constantCurrents.set(node, valueCasted);
 }
 
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setAdmittances(int count, int const *rows, int const *columns, double const *real, double const *imaginary)
+{
+	_admittances.unfreeze();
+
+	for (auto i = 0; i < count; ++i)
+	{
+		auto valueCasted = createComplexFloating(Complex<long double>(real[i], imaginary[i]));
+		assert(isValueFinite(std::abs2(valueCasted)));
+		_admittances.set(rows[i], columns[i], valueCasted);
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setAdmittancesCompressed(int const *rowPointers, int const *columns, double const *real, double const *imaginary)
+{
+	_admittances.unfreeze();
+
+	for (auto row = 0; row < _nodeCount; ++row)
+		for (auto i = rowPointers[row]; i < rowPointers[row + 1]; ++i)
+		{
+			auto valueCasted = createComplexFloating(Complex<long double>(real[i], imaginary[i]));
+			assert(isValueFinite(std::abs2(valueCasted)));
+			_admittances.set(row, columns[i], valueCasted);
+		}
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setAdmittanceRowSums(double const *real, double const *imaginary)
+{
+	for (auto row = 0; row < _nodeCount; ++row)
+		setAdmittanceRowSum(row, Complex<long double>(real[row], imaginary[row]));
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setPQBuses(int const *nodes, double const *powerReal, double const *powerImaginary)
+{
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		setPQBusesOfScenario(scenario, nodes, powerReal, powerImaginary);
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setPVBuses(int const *nodes, double const *powerReal, double const *voltageMagnitude)
+{
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		setPVBusesOfScenario(scenario, nodes, powerReal, voltageMagnitude);
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setPQBusesOfScenario(int scenario, int const *nodes, double const *powerReal, double const *powerImaginary)
+{
+	assert(scenario >= 0 && scenario < _scenarioCount);
+
+	for (auto i = 0; i < _pqBusCount; ++i)
+	{
+		auto power = Complex<long double>(powerReal[i], powerImaginary[i]);
+		assert(isValueFinite(std::abs2(power)));
+		_pqBuses[scenario][i] = PQBus(nodes[i], power);
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setPVBusesOfScenario(int scenario, int const *nodes, double const *powerReal, double const *voltageMagnitude)
+{
+	assert(scenario >= 0 && scenario < _scenarioCount);
+
+	for (auto i = 0; i < _pvBusCount; ++i)
+	{
+		assert(isValueFinite(powerReal[i]));
+		assert(isValueFinite(voltageMagnitude[i]));
+		_pvBuses[scenario][i] = PVBus(nodes[i], powerReal[i], voltageMagnitude[i]);
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setConstantCurrents(double const *real, double const *imaginary)
+{
+	for (auto i = 0; i < _nodeCount; ++i)
+		setConstantCurrent(i, Complex<long double>(real[i], imaginary[i]));
+}
+
+// the voltages are only continued analytically every few coefficients, which saves time if many coefficients are necessary anyway
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setContinuationInterval(int stepCount)
+{
+	if (stepCount < 1)
+		throw invalid_argument("the continuation interval must be at least one step");
+
+	_continuationInterval = stepCount;
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setAnalyticContinuationMethod(AnalyticContinuationMethod method)
+{
+	_analyticContinuationMethod = method;
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setBiCGSTABPreconditioner(BiCGSTABPreconditioner preconditioner)
+{
+	_preconditioner = preconditioner;
+}
+
+// the iterative solver reuses this many previous solutions of the same scenario, which saves iterations but makes each one more expensive,
+// therefore it is disabled by default
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setSolutionHistoryLength(int length)
+{
+	if (length < 0)
+		throw invalid_argument("the solution history length must not be negative");
+
+	_solutionHistoryLength = length;
+}
+
+// by default the iterative solver continues down to the machine epsilon, as the errors of the linear solves add up over the coefficients,
+// a bigger relative tolerance stops each solve earlier at the cost of less accurate coefficients, zero restores the default
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setIterativeSolverTolerance(double tolerance)
+{
+	if (tolerance < 0)
+		throw invalid_argument("the tolerance of the iterative solver must not be negative");
+
+	_iterativeSolverTolerance = tolerance;
+}
+
+// if sentinel nodes are set the convergence is only checked at these, therefore only them and their neighbours have to be continued
+// during the calculation, all other nodes are continued once for the best result at the end
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setSentinelNodes(int count, int const *nodes)
+{
+	_sentinelNodes.clear();
+	_isSentinel.assign(_nodeCount, false);
+
+	for (auto i = 0; i < count; ++i)
+	{
+		if (nodes[i] < 0 || nodes[i] >= _nodeCount)
+			throw out_of_range("the sentinel node does not exist");
+
+		if (!_isSentinel[nodes[i]])
+			_sentinelNodes.push_back(nodes[i]);
+
+		_isSentinel[nodes[i]] = true;
+	}
+}
+
 template<typename Floating, typename ComplexFloating>
 void Calculator<Floating, ComplexFloating>::calculate()
+{
+	CancellationToken cancellationToken;
+	calculate(cancellationToken);
+}
+
+// a cancelled calculation keeps the best voltages it found so far, the result tells if the calculation actually stopped early
+// because of the cancellation, a cancellation requested after the last coefficient does not count
+template<typename Floating, typename ComplexFloating>
+bool Calculator<Floating, ComplexFloating>::calculate(CancellationToken const &cancellationToken)
 {          
 	assert(_constantCurrents.isFinite());
 
@@ -101,77 +298,195 @@ void Calculator<Floating, ComplexFloating>::calculate()
 		_progress = 0;
 		_relativePowerError = 1;
 		_maximumPossibleCoefficientCount = -1;
+
+		for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		{
+			_relativePowerErrors[scenario] = 1;
+			_errorHistories[scenario].clear();
+			_errorHistories[scenario].reserve(_numberOfCoefficients);
+		}
 	}
 
 	for (auto i = 0; i < _admittances.getColumnCount(); ++i)
 		if (std::abs(_admittances(i, i)) == Floating(0))
 			throw invalid_argument("zero values in the main diagonal of the admittance matrix are not supported");
 
+	checkScenarioBuses();
 	freeMemory();
-	_coefficientStorage = new CoefficientStorage<ComplexFloating, Floating>(_numberOfCoefficients, _nodeCount, _pqBuses, _pvBuses, _admittances);
+	_admittances.freeze();
+	updateContinuedNodes();
+
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		_coefficientStorages.push_back(new CoefficientStorage<ComplexFloating, Floating>(_numberOfCoefficients, _nodeCount, _pqBuses[scenario], _pvBuses[scenario], _admittances));
+
 	if (_iterativeSolver)
-		_solver = new BiCGSTAB<Floating, ComplexFloating>(_admittances, Floating(_targetPrecision*1e-10));
+	{
+		_solver = new BiCGSTAB<Floating, ComplexFloating>(_admittances, createFloating(_iterativeSolverTolerance), createPreconditioner());
+
+		if (_solutionHistoryLength > 0)
+			for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+				_solutionHistories.push_back(new SolutionHistory<Floating, ComplexFloating>(_nodeCount, _solutionHistoryLength));
+	}
 	else
-		_solver = new LUDecompositionStable<Floating, ComplexFloating>(_admittances);
+	{
+		auto solver = _luSymbolic == 0 ? new LUDecompositionStable<Floating, ComplexFloating>(_admittances, LUDecompositionOrderingMinimumDegree) : new LUDecompositionStable<Floating, ComplexFloating>(_admittances, *_luSymbolic);
+		delete _luSymbolic;
+		_luSymbolic = new LUDecompositionSymbolic(solver->getSymbolic());
+		_solver = solver;
+	}
 
-	for (auto i = 0; i < _nodeCount; ++i)
-		_continuations.push_back(new AnalyticContinuation<Floating, ComplexFloating>(*_coefficientStorage, i, _numberOfCoefficients));
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		for (auto i = 0; i < _nodeCount; ++i)
+			_continuations[scenario].push_back(createContinuation(scenario, i));
 	
 	try
 	{	
 		calculateFirstCoefficient();
-		updateProgress(1);
+		updateProgress(0, 1);
+		notifyProgress();
 		calculateSecondCoefficient();
-		updateProgress(1);
+		updateProgress(0, 1);
+		notifyProgress();
 	} 
 	catch(exception)
 	{
 		lock_guard<mutex> lock(_progressMutex);
-		_maximumPossibleCoefficientCount = _coefficientStorage->getCoefficientCount();
-		return;
+		_maximumPossibleCoefficientCount = _coefficientStorages[0]->getCoefficientCount();
+		return false;
 	}
 
-	map<double, int> totalErrors;
-	vector< vector< Complex<long double> > > partialResults;
-	partialResults.reserve(_numberOfCoefficients);
+	// all scenarios share the factorization of the admittance matrix and advance their coefficients together,
+	// until each one of them converged, stalled or failed
+	vector<int> activeScenarios;
+	vector<int> remainingScenarios;
+	vector<double> bestErrors(_scenarioCount, 0);
+	vector<bool> bestResultsAvailable(_scenarioCount, false);
+	vector<int> bestCoefficientCounts(_scenarioCount, 0);
+
+	auto cancelled = false;
+	activeScenarios.reserve(_scenarioCount);
+	remainingScenarios.reserve(_scenarioCount);
+
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		activeScenarios.push_back(scenario);
 	
-	while (_coefficientStorage->getCoefficientCount() < _numberOfCoefficients)
+	while (!activeScenarios.empty() && _coefficientStorages[activeScenarios.front()]->getCoefficientCount() < _numberOfCoefficients)
 	{
+		if (cancellationToken.isCancellationRequested())
+		{
+			cancelled = true;
+			break;
+		}
+
+		remainingScenarios.clear();
+		auto terminated = false;
+
 		try
 		{
-			calculateNextCoefficient();
-			calculateVoltagesFromCoefficients();
+			calculateNextCoefficient(activeScenarios);
 		}
 		catch(exception)
 		{
-			lock_guard<mutex> lock(_progressMutex);
-			_maximumPossibleCoefficientCount = _coefficientStorage->getCoefficientCount();
+			for (auto scenario : activeScenarios)
+				updateMaximumPossibleCoefficientCount(scenario);
 			break;
 		}
 
-		double totalError = calculateTotalRelativeError();
-		totalErrors.insert(pair<double, int>(totalError, partialResults.size()));
-		partialResults.push_back(_voltages);
-		updateProgress(totalErrors.begin()->first);
+		for (auto scenario : activeScenarios)
+		{
+			if (!isContinuationStep(scenario))
+			{
+				remainingScenarios.push_back(scenario);
+				continue;
+			}
+
+			try
+			{
+				calculateVoltagesFromCoefficients(scenario);
+			}
+			catch(exception)
+			{
+				updateMaximumPossibleCoefficientCount(scenario);
+				continue;
+			}
+
+			double totalError = calculateTotalRelativeError(scenario, areSentinelsUsed());
+
+			{
+				lock_guard<mutex> lock(_progressMutex);
+				_errorHistories[scenario].push_back(totalError);
+			}
+
+			// the voltages of the next step overwrite all values, therefore swapping is enough to keep the best result
+			if (!bestResultsAvailable[scenario] || totalError < bestErrors[scenario])
+			{
+				bestErrors[scenario] = totalError;
+				bestResultsAvailable[scenario] = true;
+				bestCoefficientCounts[scenario] = _coefficientStorages[scenario]->getCoefficientCount();
+				_voltages[scenario].swap(_bestVoltages[scenario]);
+			}
+
+			updateProgress(scenario, bestErrors[scenario]);
+
+			if (isConverged(totalError) || isStalledOrDiverging(_errorHistories[scenario]))
+				terminated = true;
+			else
+				remainingScenarios.push_back(scenario);
+		}
+
+		activeScenarios.swap(remainingScenarios);
+
+		if (activeScenarios.empty() && terminated)
+		{
+			lock_guard<mutex> lock(_progressMutex);
+			_progress = 1;
+		}
+
+		notifyProgress();
 	}
 
-	if (!totalErrors.empty())
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
 	{
-		int bestResultIndex = totalErrors.begin()->second;
-		_voltages = partialResults[bestResultIndex];
+		if (!bestResultsAvailable[scenario])
+			continue;
+
+		_voltages[scenario].swap(_bestVoltages[scenario]);
+
+		if (!areSentinelsUsed())
+			continue;
+
+		try
+		{
+			completeVoltagesFromCoefficients(scenario, bestCoefficientCounts[scenario]);
+			updateRelativePowerError(scenario, calculateTotalRelativeError(scenario, false));
+		}
+		catch(exception)
+		{
+			updateMaximumPossibleCoefficientCount(scenario);
+		}
 	}
+
+	return cancelled;
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::setProgressCallback(ProgressCallback callback, int calculatorId)
+{
+	lock_guard<mutex> lock(_progressMutex);
+	_progressCallback = callback;
+	_progressCallbackCalculatorId = calculatorId;
 }
 
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getVoltageReal(int node) const
 {
-	return static_cast<double>(_voltages[node].real());
+	return static_cast<double>(_voltages[0][node].real());
 }
 
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getVoltageImaginary(int node) const
 {
-	return static_cast<double>(_voltages[node].imag());
+	return static_cast<double>(_voltages[0][node].imag());
 }
 	
 template<typename Floating, typename ComplexFloating>
@@ -180,26 +495,42 @@ ComplexFloating Calculator<Floating, ComplexFloating>::createComplexFloating(Com
 	return ComplexFloating(createFloating(value.real()), createFloating(value.imag()));
 }
 
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::checkScenarioBuses() const
+{
+	for (auto scenario = 1; scenario < _scenarioCount; ++scenario)
+	{
+		for (auto i = 0; i < _pqBusCount; ++i)
+			if (_pqBuses[scenario][i].getId() != _pqBuses[0][i].getId())
+				throw invalid_argument("all scenarios must have the PQ buses at the same nodes");
+
+		for (auto i = 0; i < _pvBusCount; ++i)
+			if (_pvBuses[scenario][i].getId() != _pvBuses[0][i].getId())
+				throw invalid_argument("all scenarios must have the PV buses at the same nodes");
+	}
+}
+
+// the first coefficient does not depend on the powers, therefore it is shared by all scenarios
 template<typename Floating, typename ComplexFloating>
 void Calculator<Floating, ComplexFloating>::calculateFirstCoefficient()
 {
 	auto coefficients = calculateFirstCoefficientInternal();
 	auto modificationNecessary = isPQCoefficientZero(coefficients);
 
-	if (!modificationNecessary)
-	{		
-		_coefficientStorage->addCoefficients(coefficients);
-		return;
+	if (modificationNecessary)
+	{
+		_embeddingModification = ComplexFloating(createFloating(1));
+		coefficients = calculateFirstCoefficientInternal();
+		modificationNecessary = isPQCoefficientZero(coefficients);
+
+		if (modificationNecessary)
+			throw exception("one modification was not enough");
 	}
-	
-	_embeddingModification = ComplexFloating(createFloating(1));
-	coefficients = calculateFirstCoefficientInternal();
-	modificationNecessary = isPQCoefficientZero(coefficients);
 
-	if (modificationNecessary)
-		throw exception("one modification was not enough");
+	for (size_t scenario = 0; scenario + 1 < _coefficientStorages.size(); ++scenario)
+		_coefficientStorages[scenario]->addCoefficients(coefficients);
 
-	_coefficientStorage->addCoefficients(coefficients);
+	_coefficientStorages.back()->addCoefficients(std::move(coefficients));
 }
 
 template<typename Floating, typename ComplexFloating>
@@ -207,28 +538,40 @@ Vector<Floating, ComplexFloating> Calculator<Floating, ComplexFloating>::calcula
 {
 	Vector<Floating, ComplexFloating> rightHandSide(_nodeCount);
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _pqBusCount; ++i)
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
 	{
-		const PQBus &bus = _pqBuses[i];
-		auto id = bus.getId();
-		ComplexFloating const& constantCurrent = _constantCurrents(id);
-		ComplexFloating const& totalAdmittanceRowSum = _totalAdmittanceRowSums[id];
-		auto value = constantCurrent - (totalAdmittanceRowSum + _embeddingModification);
-		assert(isValueFinite(std::abs2(value)));
-		rightHandSide.set(id, value);
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pqBusCount; ++i)
+		{
+			const PQBus &bus = _pqBuses[0][i];
+			auto id = bus.getId();
+			ComplexFloating const& constantCurrent = _constantCurrents(id);
+			ComplexFloating const& totalAdmittanceRowSum = _totalAdmittanceRowSums[id];
+			auto value = constantCurrent - (totalAdmittanceRowSum + _embeddingModification);
+			assert(isValueFinite(std::abs2(value)));
+			rightHandSide.set(id, value);
+		}
 	}
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _pvBusCount; ++i)
+	#pragma omp parallel
 	{
-		PVBus const& bus = _pvBuses[i];
-		auto id = bus.getId();
-		ComplexFloating const& admittanceRowSum = _totalAdmittanceRowSums[id];
-		ComplexFloating const& constantCurrent = _constantCurrents(id);
-		auto value = admittanceRowSum + constantCurrent;
-		assert(isValueFinite(std::abs2(value)));
-		rightHandSide.set(id, value);
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pvBusCount; ++i)
+		{
+			PVBus const& bus = _pvBuses[0][i];
+			auto id = bus.getId();
+			ComplexFloating const& admittanceRowSum = _totalAdmittanceRowSums[id];
+			ComplexFloating const& constantCurrent = _constantCurrents(id);
+			auto value = admittanceRowSum + constantCurrent;
+			assert(isValueFinite(std::abs2(value)));
+			rightHandSide.set(id, value);
+		}
 	}
 
 	return _solver->solve(rightHandSide);
@@ -237,150 +580,355 @@ Vector<Floating, ComplexFloating> Calculator<Floating, ComplexFloating>::calcula
 template<typename Floating, typename ComplexFloating>
 void Calculator<Floating, ComplexFloating>::calculateSecondCoefficient()
 {
-	Vector<Floating, ComplexFloating> rightHandSide(_nodeCount);
-	
-	#pragma omp parallel for
-	for (auto i = 0; i < _pqBusCount; ++i)
+	vector<int> scenarios(_scenarioCount);
+	resizeCoefficientBuffers(_scenarioCount);
+
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
 	{
-		PQBus const& bus = _pqBuses[i];
-		auto id = bus.getId();
-		auto power = createComplexFloating(bus.getPower());
-		ComplexFloating const& totalAdmittanceRowSum = _totalAdmittanceRowSums[id];
-		ComplexFloating const& lastInverseCoefficient = _coefficientStorage->getLastInverseCoefficient(id);
-		auto current = conj(power*lastInverseCoefficient);
-		auto value = current + totalAdmittanceRowSum + _embeddingModification;
-		assert(isValueFinite(std::abs2(value)));
-		rightHandSide.set(id, value);
+		auto &rightHandSide = _rightHandSides[scenario];
+		scenarios[scenario] = scenario;
+		auto const &coefficientStorage = *_coefficientStorages[scenario];
+	
+		auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+		#pragma omp parallel
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto i = 0; i < _pqBusCount; ++i)
+			{
+				PQBus const& bus = _pqBuses[scenario][i];
+				auto id = bus.getId();
+				auto power = createComplexFloating(bus.getPower());
+				ComplexFloating const& totalAdmittanceRowSum = _totalAdmittanceRowSums[id];
+				ComplexFloating const& lastInverseCoefficient = coefficientStorage.getLastInverseCoefficient(id);
+				auto current = conj(power*lastInverseCoefficient);
+				auto value = current + totalAdmittanceRowSum + _embeddingModification;
+				assert(isValueFinite(std::abs2(value)));
+				rightHandSide.set(id, value);
+			}
+		}
+	
+		#pragma omp parallel
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto i = 0; i < _pvBusCount; ++i)
+			{
+				PVBus const& bus = _pvBuses[scenario][i];
+				auto id = bus.getId();
+				ComplexFloating const& admittanceRowSum = _totalAdmittanceRowSums[id];
+				auto value = calculateRightHandSide(scenario, bus) - admittanceRowSum;
+				assert(isValueFinite(std::abs2(value)));	
+				rightHandSide.set(id, value);
+			}
+		}
 	}
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _pvBusCount; ++i)
+	solveMultiple(scenarios);
+
+	// the solutions are only buffers, which are overwritten by the next solve
+	for (auto scenario = 0; scenario < _scenarioCount; ++scenario)
+		_coefficientStorages[scenario]->addCoefficients(std::move(_solutions[scenario]));
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::calculateNextCoefficient(vector<int> const &scenarios)
+{
+	resizeCoefficientBuffers(scenarios.size());
+
+	for (size_t j = 0; j < scenarios.size(); ++j)
 	{
-		PVBus const& bus = _pvBuses[i];
-		auto id = bus.getId();
-		ComplexFloating const& admittanceRowSum = _totalAdmittanceRowSums[id];
-		auto value = calculateRightHandSide(bus) - admittanceRowSum;
-		assert(isValueFinite(std::abs2(value)));	
-		rightHandSide.set(id, value);
+		auto scenario = scenarios[j];
+		auto &rightHandSide = _rightHandSides[j];
+		auto const &coefficientStorage = *_coefficientStorages[scenario];
+			
+		auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+		#pragma omp parallel
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto i = 0; i < _pqBusCount; ++i)
+			{
+				const PQBus &bus = _pqBuses[scenario][i];
+				auto id = bus.getId();
+				auto power = createComplexFloating(bus.getPower());
+				ComplexFloating const& lastInverseCoefficient = coefficientStorage.getLastInverseCoefficient(id);
+				auto value = conj(power*lastInverseCoefficient);
+				assert(isValueFinite(std::abs2(value)));
+				rightHandSide.set(id, value);
+			}
+		}
+		
+		#pragma omp parallel
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto i = 0; i < _pvBusCount; ++i)
+			{
+				PVBus const& bus = _pvBuses[scenario][i];
+				auto id = bus.getId();
+				auto value = calculateRightHandSide(scenario, bus);
+				assert(isValueFinite(std::abs2(value)));
+				rightHandSide.set(id, value);
+			}
+		}
 	}
 	
-	auto coefficients = _solver->solve(rightHandSide);
-	_coefficientStorage->addCoefficients(coefficients);
+	solveMultiple(scenarios);
+
+	for (size_t j = 0; j < scenarios.size(); ++j)
+		_coefficientStorages[scenarios[j]]->addCoefficients(std::move(_solutions[j]));
 }
 
+// the buffers are reused for every coefficient, the scenarios only share them because all of them have their buses at the same nodes,
+// therefore the elements of the right hand sides which are not written stay zero
 template<typename Floating, typename ComplexFloating>
-void Calculator<Floating, ComplexFloating>::calculateNextCoefficient()
+void Calculator<Floating, ComplexFloating>::resizeCoefficientBuffers(size_t count)
 {
-	Vector<Floating, ComplexFloating> rightHandSide(_nodeCount);
-			
-	#pragma omp parallel for
-	for (auto i = 0; i < _pqBusCount; ++i)
+	while (_rightHandSides.size() > count)
 	{
-		const PQBus &bus = _pqBuses[i];
-		auto id = bus.getId();
-		auto power = createComplexFloating(bus.getPower());
-		ComplexFloating const& lastInverseCoefficient = _coefficientStorage->getLastInverseCoefficient(id);
-		auto value = conj(power*lastInverseCoefficient);
-		assert(isValueFinite(std::abs2(value)));
-		rightHandSide.set(id, value);
+		_rightHandSides.pop_back();
+		_solutions.pop_back();
 	}
-		
-	#pragma omp parallel for
-	for (auto i = 0; i < _pvBusCount; ++i)
+
+	while (_rightHandSides.size() < count)
 	{
-		PVBus const& bus = _pvBuses[i];
-		auto id = bus.getId();
-		auto value = calculateRightHandSide(bus);
-		assert(isValueFinite(std::abs2(value)));
-		rightHandSide.set(id, value);
+		_rightHandSides.push_back(Vector<Floating, ComplexFloating>(_nodeCount));
+		_solutions.push_back(Vector<Floating, ComplexFloating>(_nodeCount));
 	}
-	
-	auto coefficients = _solver->solve(rightHandSide);
-	_coefficientStorage->addCoefficients(coefficients);
 }
 
+// consecutive right hand sides of one scenario change smoothly, therefore the iterative solver can reuse the previous solutions
 template<typename Floating, typename ComplexFloating>
-ComplexFloating Calculator<Floating, ComplexFloating>::calculateRightHandSide(PVBus const& bus)
+void Calculator<Floating, ComplexFloating>::solveMultiple(vector<int> const &scenarios)
+{
+	if (_solutionHistories.empty())
+	{
+		_solver->solveMultiple(_rightHandSides, _solutions);
+		return;
+	}
+
+	for (size_t j = 0; j < scenarios.size(); ++j)
+	{
+		auto &solutionHistory = *_solutionHistories[scenarios[j]];
+		_solver->solveWithHistory(_rightHandSides[j], solutionHistory, _solutions[j]);
+		solutionHistory.add(_rightHandSides[j], _solutions[j]);
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+ComplexFloating Calculator<Floating, ComplexFloating>::calculateRightHandSide(int scenario, PVBus const& bus)
 {
 	auto id = bus.getId();
 	auto realPower = createFloating(bus.getPowerReal());
-	ComplexFloating const& previousCoefficient = _coefficientStorage->getLastCoefficient(id);
-	ComplexFloating const& previousCombinedCoefficient = _coefficientStorage->getLastCombinedCoefficient(id);
-	ComplexFloating const& previousSquaredCoefficient = _coefficientStorage->getLastSquaredCoefficient(id);
+	auto const &coefficientStorage = *_coefficientStorages[scenario];
+	ComplexFloating const& previousCoefficient = coefficientStorage.getLastCoefficient(id);
+	ComplexFloating const& previousCombinedCoefficient = coefficientStorage.getLastCombinedCoefficient(id);
+	ComplexFloating const& previousSquaredCoefficient = coefficientStorage.getLastSquaredCoefficient(id);
 	ComplexFloating const& constantCurrent = _constantCurrents(id);
 	auto magnitudeSquare = createFloating(bus.getVoltageMagnitude()*bus.getVoltageMagnitude());
 	return (previousCoefficient*ComplexFloating(realPower*createFloating(2)) - previousCombinedCoefficient + previousSquaredCoefficient*conj(constantCurrent))/ComplexFloating(magnitudeSquare);
 }
 
+// this is called for every continuation step, therefore the vectors are workspaces of the calculator,
+// with only the sentinels the other values of the currents and powers are left from a previous call, but are not used
 template<typename Floating, typename ComplexFloating>
-double Calculator<Floating, ComplexFloating>::calculatePowerError() const
+double Calculator<Floating, ComplexFloating>::calculatePowerError(int scenario, bool sentinelsOnly) const
 {
-	Vector<Floating, ComplexFloating> currents(_nodeCount);
-	Vector<Floating, ComplexFloating> voltages(_nodeCount);
-	getVoltagesAsVectorComplexFloating(voltages);
-	_admittances.multiply(currents, voltages);
+	auto const &pqBuses = _pqBuses[scenario];
+	auto const &pvBuses = _pvBuses[scenario];
+	auto &currents = _powerErrorCurrents;
+	auto &voltages = _powerErrorVoltages;
+	auto &powers = _powerErrorPowers;
+	getVoltagesAsVectorComplexFloating(scenario, voltages);
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	if (sentinelsOnly)
+	{
+		int sentinelCount = _sentinelNodes.size();
+
+		#pragma omp parallel
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto i = 0; i < sentinelCount; ++i)
+				currents.set(_sentinelNodes[i], _admittances.multiplyRowWithStartColumn(_sentinelNodes[i], voltages, 0));
+		}
+	}
+	else
+		_admittances.multiply(currents, voltages);
+
 	currents.subtract(currents, _constantCurrents);
 	currents.conjugate();
-	Vector<Floating, ComplexFloating> powers(_nodeCount);
 	powers.pointwiseMultiply(currents, voltages);	
 	double sum = 0;
 	
-	#pragma omp parallel for reduction(+:sum)
-	for (auto i = 0; i < _pqBusCount; ++i)
+	#pragma omp parallel
 	{
-		auto currentPower = powers(_pqBuses[i].getId());
-		auto currentPowerCasted = Complex<long double>(real(currentPower), imag(currentPower));
-		auto powerShouldBe = _pqBuses[i].getPower();
-		auto difference = currentPowerCasted - powerShouldBe;
-		auto realDifferenceRelative = real(powerShouldBe) != 0 ? real(difference)/real(powerShouldBe) : real(difference);
-		auto imaginaryDifferenceRelative = imag(powerShouldBe) != 0 ? imag(difference)/imag(powerShouldBe) : imag(difference);
-		sum += abs(realDifferenceRelative) + abs(imaginaryDifferenceRelative);
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for reduction(+:sum)
+		for (auto i = 0; i < _pqBusCount; ++i)
+		{
+			if (sentinelsOnly && !_isSentinel[pqBuses[i].getId()])
+				continue;
+
+			auto currentPower = powers(pqBuses[i].getId());
+			auto currentPowerCasted = Complex<long double>(real(currentPower), imag(currentPower));
+			auto powerShouldBe = pqBuses[i].getPower();
+			auto difference = currentPowerCasted - powerShouldBe;
+			auto realDifferenceRelative = real(powerShouldBe) != 0 ? real(difference)/real(powerShouldBe) : real(difference);
+			auto imaginaryDifferenceRelative = imag(powerShouldBe) != 0 ? imag(difference)/imag(powerShouldBe) : imag(difference);
+			sum += abs(realDifferenceRelative) + abs(imaginaryDifferenceRelative);
+		}
 	}
 	
-	#pragma omp parallel for reduction(+:sum)
-	for (auto i = 0; i < _pvBusCount; ++i)
+	#pragma omp parallel
 	{
-		auto currentPower = static_cast<long double>(real(powers(_pvBuses[i].getId())));
-		auto powerShouldBe  = _pvBuses[i].getPowerReal();
-		auto difference = currentPower - powerShouldBe;
-		auto differenceRelative = powerShouldBe != 0 ? difference/powerShouldBe : difference;
-		sum += abs(differenceRelative);
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for reduction(+:sum)
+		for (auto i = 0; i < _pvBusCount; ++i)
+		{
+			if (sentinelsOnly && !_isSentinel[pvBuses[i].getId()])
+				continue;
+
+			auto currentPower = static_cast<long double>(real(powers(pvBuses[i].getId())));
+			auto powerShouldBe  = pvBuses[i].getPowerReal();
+			auto difference = currentPower - powerShouldBe;
+			auto differenceRelative = powerShouldBe != 0 ? difference/powerShouldBe : difference;
+			sum += abs(differenceRelative);
+		}
 	}
 
 	return sum;
 }
 
 template<typename Floating, typename ComplexFloating>
-double Calculator<Floating, ComplexFloating>::calculateVoltageError() const
+double Calculator<Floating, ComplexFloating>::calculateVoltageError(int scenario, bool sentinelsOnly) const
 {	
+	auto const &voltages = _voltages[scenario];
 	double sum = 0;
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
 	
-	#pragma omp parallel for reduction(+:sum)
-	for (auto i = 0; i < _pvBusCount; ++i)
+	#pragma omp parallel
 	{
-		PVBus const &bus = _pvBuses[i];
-		auto id = bus.getId();
-		auto currentMagnitude = abs(_voltages[id]);
-		auto magnitudeShouldBe = bus.getVoltageMagnitude();
-		sum += abs((currentMagnitude - magnitudeShouldBe)/magnitudeShouldBe);
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for reduction(+:sum)
+		for (auto i = 0; i < _pvBusCount; ++i)
+		{
+			PVBus const &bus = _pvBuses[scenario][i];
+			auto id = bus.getId();
+
+			if (sentinelsOnly && !_isSentinel[id])
+				continue;
+
+			auto currentMagnitude = abs(voltages[id]);
+			auto magnitudeShouldBe = bus.getVoltageMagnitude();
+			sum += abs((currentMagnitude - magnitudeShouldBe)/magnitudeShouldBe);
+		}
 	}
 
 	return sum;
 }
 
 template<typename Floating, typename ComplexFloating>
-double Calculator<Floating, ComplexFloating>::calculateTotalRelativeError() const
+double Calculator<Floating, ComplexFloating>::calculateTotalRelativeError(int scenario, bool sentinelsOnly) const
 {	
-	auto powerError = calculatePowerError();
-	auto voltageError = calculateVoltageError();
+	auto powerError = calculatePowerError(scenario, sentinelsOnly);
+	auto voltageError = calculateVoltageError(scenario, sentinelsOnly);
 	return powerError + voltageError;
 }
 
+// the last coefficient is always continued, otherwise the calculation could end without using the most accurate result
+template<typename Floating, typename ComplexFloating>
+bool Calculator<Floating, ComplexFloating>::isContinuationStep(int scenario) const
+{
+	auto coefficientCount = _coefficientStorages[scenario]->getCoefficientCount();
+	return coefficientCount % _continuationInterval == 0 || coefficientCount >= _numberOfCoefficients;
+}
+
+template<typename Floating, typename ComplexFloating>
+bool Calculator<Floating, ComplexFloating>::areSentinelsUsed() const
+{
+	return !_sentinelNodes.empty();
+}
+
+// the power error at a sentinel node needs the voltages of all its neighbours
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::updateContinuedNodes()
+{
+	_continuedNodes.clear();
+	_isContinued.assign(_nodeCount, !areSentinelsUsed());
+
+	for (auto node : _sentinelNodes)
+		for (auto i = _admittances.getRowIterator(node); i.isValid(); i.next())
+			_isContinued[i.getColumn()] = true;
+
+	for (auto i = 0; i < _nodeCount; ++i)
+		if (_isContinued[i])
+			_continuedNodes.push_back(i);
+}
+
+template<typename Floating, typename ComplexFloating>
+bool Calculator<Floating, ComplexFloating>::isConverged(double totalError) const
+{
+	return totalError <= _targetPrecision/_nominalVoltage;
+}
+
+// stalled if the best error did not improve significantly during the last coefficients,
+// diverging if the error grew during all of the last coefficients far beyond the best one
+template<typename Floating, typename ComplexFloating>
+bool Calculator<Floating, ComplexFloating>::isStalledOrDiverging(vector<double> const &errors)
+{
+	const int stallCount = 10;
+	const double stallImprovement = 0.5;
+	const int divergenceCount = 5;
+	const double divergenceFactor = 1e3;
+	int count = errors.size();
+
+	if (count > stallCount)
+	{
+		auto bestBefore = *min_element(errors.begin(), errors.end() - stallCount);
+		auto bestLately = *min_element(errors.end() - stallCount, errors.end());
+
+		if (bestLately > stallImprovement*bestBefore)
+			return true;
+	}
+
+	if (count > divergenceCount)
+	{
+		auto best = *min_element(errors.begin(), errors.end());
+
+		for (auto i = count - divergenceCount; i < count; ++i)
+			if (!(errors[i] > errors[i - 1] && errors[i] > divergenceFactor*best))
+				return false;
+
+		return true;
+	}
+
+	return false;
+}
+
 template<typename Floating, typename ComplexFloating>
 void Calculator<Floating, ComplexFloating>::freeMemory()
 {
-	delete _coefficientStorage;
-	_coefficientStorage = 0;
+	for (auto coefficientStorage : _coefficientStorages)
+		delete coefficientStorage;
+	_coefficientStorages.clear();
+	for (auto solutionHistory : _solutionHistories)
+		delete solutionHistory;
+	_solutionHistories.clear();
+	_rightHandSides.clear();
+	_solutions.clear();
 	delete _solver;
 	_solver = 0;
 	deleteContinuations();
@@ -389,19 +937,115 @@ void Calculator<Floating, ComplexFloating>::freeMemory()
 template<typename Floating, typename ComplexFloating>
 void Calculator<Floating, ComplexFloating>::deleteContinuations()
 {
-	for (auto i = 0; i < static_cast<int>(_continuations.size()); ++i)
-		delete _continuations[i];
-	_continuations.clear();
+	for (auto &continuations : _continuations)
+	{
+		for (auto i = 0; i < static_cast<int>(continuations.size()); ++i)
+			delete continuations[i];
+		continuations.clear();
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+IAnalyticContinuation<Floating, ComplexFloating>* Calculator<Floating, ComplexFloating>::createContinuation(int scenario, int node) const
+{
+	switch (_analyticContinuationMethod)
+	{
+	case AnalyticContinuationMethodWynnEpsilon:
+		return new AnalyticContinuation<Floating, ComplexFloating>(*_coefficientStorages[scenario], node, _numberOfCoefficients);
+	case AnalyticContinuationMethodViskovatov:
+		return new AnalyticContinuationViskovatov<Floating, ComplexFloating>(*_coefficientStorages[scenario], node, _numberOfCoefficients);
+	}
+
+	throw invalid_argument("unknown analytic continuation method");
 }
 
+// the threshold variant drops values below 1e-8 of the row norm and allows 50 additional values per row of each factor,
+// coarser settings let BiCGSTAB diverge on meshed grids
 template<typename Floating, typename ComplexFloating>
-void Calculator<Floating, ComplexFloating>::calculateVoltagesFromCoefficients()
+IPreconditioner<Floating, ComplexFloating>* Calculator<Floating, ComplexFloating>::createPreconditioner() const
 {
-	for (auto i = 0; i < _nodeCount; ++i)
+	switch (_preconditioner)
 	{
-		_continuations[i]->updateWithLastCoefficients();
-		_voltages[i] = _continuations[i]->getResult();
+	case BiCGSTABPreconditionerJacobi:
+		return new PreconditionerJacobi<Floating, ComplexFloating>(_admittances);
+	case BiCGSTABPreconditionerIncompleteLU:
+		return new PreconditionerIncompleteLU<Floating, ComplexFloating>(_admittances);
+	case BiCGSTABPreconditionerIncompleteLUThreshold:
+		return new PreconditionerIncompleteLU<Floating, ComplexFloating>(_admittances, Floating(1e-8), 50);
 	}
+
+	throw invalid_argument("unknown preconditioner");
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::calculateVoltagesFromCoefficients(int scenario)
+{
+	auto const &continuations = _continuations[scenario];
+	auto &voltages = _voltages[scenario];
+	int count = _continuedNodes.size();
+	auto failureCount = 0;
+
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for reduction(+:failureCount)
+		for (auto i = 0; i < count; ++i)
+		{
+			auto node = _continuedNodes[i];
+
+			try
+			{
+				continuations[node]->updateWithLastCoefficients();
+				voltages[node] = continuations[node]->getResult();
+			}
+			catch(exception)
+			{
+				++failureCount;
+			}
+		}
+	}
+
+	if (failureCount > 0)
+		throw overflow_error("numeric error, would have to divide by zero");
+}
+
+// the continued nodes already contain the best result, the others catch up to the same coefficient
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::completeVoltagesFromCoefficients(int scenario, int coefficientCount)
+{
+	auto const &continuations = _continuations[scenario];
+	auto &voltages = _voltages[scenario];
+	auto failureCount = 0;
+
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for reduction(+:failureCount)
+		for (auto i = 0; i < _nodeCount; ++i)
+		{
+			if (_isContinued[i])
+				continue;
+
+			try
+			{
+				continuations[i]->updateWithCoefficients(coefficientCount);
+				voltages[i] = continuations[i]->getResult();
+			}
+			catch(exception)
+			{
+				++failureCount;
+			}
+		}
+	}
+
+	if (failureCount > 0)
+		throw overflow_error("numeric error, would have to divide by zero");
 }
 
 template<typename Floating, typename ComplexFloating>
@@ -425,7 +1069,7 @@ bool Calculator<Floating, ComplexFloating>::isPQCoefficientZero(Vector<Floating,
 {
 	for (auto i = 0; i < _pqBusCount; ++i)
 	{
-		PQBus const& bus = _pqBuses[i];
+		PQBus const& bus = _pqBuses[0][i];
 		auto id = bus.getId();
 
 		if (coefficients(id) == ComplexFloating())
@@ -438,29 +1082,94 @@ bool Calculator<Floating, ComplexFloating>::isPQCoefficientZero(Vector<Floating,
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getCoefficientReal(int step, int node) const
 {
-	assert(_coefficientStorage != 0);
-	return static_cast<double>(_coefficientStorage->getCoefficient(node, step).real());
+	assert(!_coefficientStorages.empty());
+	return static_cast<double>(_coefficientStorages[0]->getCoefficient(node, step).real());
 }
 
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getCoefficientImaginary(int step, int node) const
 {
-	assert(_coefficientStorage != 0);
-	return static_cast<double>(_coefficientStorage->getCoefficient(node, step).imag());
+	assert(!_coefficientStorages.empty());
+	return static_cast<double>(_coefficientStorages[0]->getCoefficient(node, step).imag());
 }
 
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getInverseCoefficientReal(int step, int node) const
 {
-	assert(_coefficientStorage != 0);
-	return static_cast<double>(_coefficientStorage->getInverseCoefficient(node, step).real());
+	assert(!_coefficientStorages.empty());
+	return static_cast<double>(_coefficientStorages[0]->getInverseCoefficient(node, step).real());
 }
 
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getInverseCoefficientImaginary(int step, int node) const
 {
-	assert(_coefficientStorage != 0);
-	return static_cast<double>(_coefficientStorage->getInverseCoefficient(node, step).imag());
+	assert(!_coefficientStorages.empty());
+	return static_cast<double>(_coefficientStorages[0]->getInverseCoefficient(node, step).imag());
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::getVoltages(double *real, double *imaginary) const
+{
+	getVoltagesOfScenario(0, real, imaginary);
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::getVoltagesOfScenario(int scenario, double *real, double *imaginary) const
+{
+	assert(scenario >= 0 && scenario < _scenarioCount);
+	auto const &voltages = _voltages[scenario];
+
+	for (auto i = 0; i < _nodeCount; ++i)
+	{
+		real[i] = static_cast<double>(voltages[i].real());
+		imaginary[i] = static_cast<double>(voltages[i].imag());
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::getCoefficients(int step, double *real, double *imaginary) const
+{
+	assert(!_coefficientStorages.empty());
+
+	for (auto i = 0; i < _nodeCount; ++i)
+	{
+		auto const &coefficient = _coefficientStorages[0]->getCoefficient(i, step);
+		real[i] = static_cast<double>(coefficient.real());
+		imaginary[i] = static_cast<double>(coefficient.imag());
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::getInverseCoefficients(int step, double *real, double *imaginary) const
+{
+	assert(!_coefficientStorages.empty());
+
+	for (auto i = 0; i < _nodeCount; ++i)
+	{
+		auto const &coefficient = _coefficientStorages[0]->getInverseCoefficient(i, step);
+		real[i] = static_cast<double>(coefficient.real());
+		imaginary[i] = static_cast<double>(coefficient.imag());
+	}
+}
+
+template<typename Floating, typename ComplexFloating>
+int Calculator<Floating, ComplexFloating>::getErrorHistoryCount()
+{
+	lock_guard<mutex> lock(_progressMutex);
+	return _errorHistories[0].size();
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::getErrorHistory(double *errors)
+{
+	lock_guard<mutex> lock(_progressMutex);
+	copy(_errorHistories[0].begin(), _errorHistories[0].end(), errors);
+}
+
+template<typename Floating, typename ComplexFloating>
+int Calculator<Floating, ComplexFloating>::getCoefficientCount() const
+{
+	return _coefficientStorages.empty() ? 0 : _coefficientStorages[0]->getCoefficientCount();
 }
 
 template<typename Floating, typename ComplexFloating>
@@ -469,6 +1178,12 @@ int Calculator<Floating, ComplexFloating>::getNodeCount() const
 	return _nodeCount;
 }
 
+template<typename Floating, typename ComplexFloating>
+int Calculator<Floating, ComplexFloating>::getScenarioCount() const
+{
+	return _scenarioCount;
+}
+
 template<typename Floating, typename ComplexFloating>
 double Calculator<Floating, ComplexFloating>::getProgress()
 {
@@ -491,22 +1206,70 @@ int Calculator<Floating, ComplexFloating>::getMaximumPossibleCoefficientCount()
 }
 
 template<typename Floating, typename ComplexFloating>
-void Calculator<Floating, ComplexFloating>::getVoltagesAsVectorComplexFloating(Vector<Floating, ComplexFloating> &result) const
+void Calculator<Floating, ComplexFloating>::getVoltagesAsVectorComplexFloating(int scenario, Vector<Floating, ComplexFloating> &result) const
 {
-	int count = _voltages.size();
+	auto const &voltages = _voltages[scenario];
+	int count = voltages.size();
 
-	#pragma omp parallel for
-	for (auto i = 0; i < count; ++i)
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
 	{
-		Complex<long double> const &voltage = _voltages[i];
-		result.set(i, ComplexFloating(Floating(real(voltage)), Floating(imag(voltage))));
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < count; ++i)
+		{
+			Complex<long double> const &voltage = voltages[i];
+			result.set(i, ComplexFloating(Floating(real(voltage)), Floating(imag(voltage))));
+		}
 	}
 }
 
 template<typename Floating, typename ComplexFloating>
-void Calculator<Floating, ComplexFloating>::updateProgress(double relativePowerError)
+void Calculator<Floating, ComplexFloating>::updateMaximumPossibleCoefficientCount(int scenario)
+{
+	lock_guard<mutex> lock(_progressMutex);
+	auto count = _coefficientStorages[scenario]->getCoefficientCount();
+
+	if (_maximumPossibleCoefficientCount < 0 || count < _maximumPossibleCoefficientCount)
+		_maximumPossibleCoefficientCount = count;
+}
+
+// the relative power error of a batch is the one of its worst scenario
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::updateProgress(int scenario, double relativePowerError)
 {
+	updateRelativePowerError(scenario, relativePowerError);
 	lock_guard<mutex> lock(_progressMutex);
-	_relativePowerError = relativePowerError;	
-	_progress = static_cast<double>(_coefficientStorage->getCoefficientCount()) / _numberOfCoefficients;
+	_progress = static_cast<double>(_coefficientStorages[scenario]->getCoefficientCount()) / _numberOfCoefficients;
+}
+
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::updateRelativePowerError(int scenario, double relativePowerError)
+{
+	lock_guard<mutex> lock(_progressMutex);
+	_relativePowerErrors[scenario] = relativePowerError;
+	_relativePowerError = *max_element(_relativePowerErrors.begin(), _relativePowerErrors.end());
+}
+
+// the callback is called without holding the lock, therefore it can query the calculator
+template<typename Floating, typename ComplexFloating>
+void Calculator<Floating, ComplexFloating>::notifyProgress()
+{
+	ProgressCallback callback;
+	int calculatorId;
+	double progress;
+	double relativePowerError;
+
+	{
+		lock_guard<mutex> lock(_progressMutex);
+		callback = _progressCallback;
+		calculatorId = _progressCallbackCalculatorId;
+		progress = _progress;
+		relativePowerError = _relativePowerError;
+	}
+
+	if (callback != 0)
+		callback(calculatorId, progress, relativePowerError);
 }
\ No newline at end of file
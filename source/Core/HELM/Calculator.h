@@ -8,15 +8,21 @@
 #include "ConsoleOutput.h"
 #include "ICalculator.h"
 #include "CoefficientStorage.h"
-#include "AnalyticContinuation.h"
+#include "IAnalyticContinuation.h"
+#include "AnalyticContinuationMethod.h"
+#include "BiCGSTABPreconditioner.h"
+#include "IPreconditioner.h"
 #include "SparseMatrix.h"
 #include "ILinearEquationSystemSolver.h"
+#include "LUDecompositionSymbolic.h"
+#include "SolutionHistory.h"
 
 template<typename Floating, typename ComplexFloating>
 class Calculator : public ICalculator
 {
 public:
 	Calculator(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	Calculator(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver);
 	virtual ~Calculator();
 
 	virtual void setAdmittance(int row, int column, Complex<long double> value);
@@ -24,14 +30,38 @@ public:
 	virtual void setPQBus(int busId, int node, Complex<long double> power);
 	virtual void setPVBus(int busId, int node, double powerReal, double voltageMagnitude);
 	virtual void setConstantCurrent(int node, Complex<long double> value);
+	virtual void setAdmittances(int count, int const *rows, int const *columns, double const *real, double const *imaginary);
+	virtual void setAdmittancesCompressed(int const *rowPointers, int const *columns, double const *real, double const *imaginary);
+	virtual void setAdmittanceRowSums(double const *real, double const *imaginary);
+	virtual void setPQBuses(int const *nodes, double const *powerReal, double const *powerImaginary);
+	virtual void setPVBuses(int const *nodes, double const *powerReal, double const *voltageMagnitude);
+	virtual void setConstantCurrents(double const *real, double const *imaginary);
+	virtual void setPQBusesOfScenario(int scenario, int const *nodes, double const *powerReal, double const *powerImaginary);
+	virtual void setPVBusesOfScenario(int scenario, int const *nodes, double const *powerReal, double const *voltageMagnitude);
+	virtual void setContinuationInterval(int stepCount);
+	virtual void setSentinelNodes(int count, int const *nodes);
+	virtual void setAnalyticContinuationMethod(AnalyticContinuationMethod method);
+	virtual void setBiCGSTABPreconditioner(BiCGSTABPreconditioner preconditioner);
+	virtual void setSolutionHistoryLength(int length);
+	virtual void setIterativeSolverTolerance(double tolerance);
 	virtual void calculate();
+	virtual bool calculate(CancellationToken const &cancellationToken);
+	virtual void setProgressCallback(ProgressCallback callback, int calculatorId);
 	virtual double getVoltageReal(int node) const;
 	virtual double getVoltageImaginary(int node) const;
 	virtual double getCoefficientReal(int step, int node) const;
 	virtual double getCoefficientImaginary(int step, int node) const;
 	virtual double getInverseCoefficientReal(int step, int node) const;
 	virtual double getInverseCoefficientImaginary(int step, int node) const;
+	virtual void getVoltages(double *real, double *imaginary) const;
+	virtual void getVoltagesOfScenario(int scenario, double *real, double *imaginary) const;
+	virtual void getCoefficients(int step, double *real, double *imaginary) const;
+	virtual void getInverseCoefficients(int step, double *real, double *imaginary) const;
+	virtual int getErrorHistoryCount();
+	virtual void getErrorHistory(double *errors);
+	virtual int getCoefficientCount() const;
 	virtual int getNodeCount() const;
+	virtual int getScenarioCount() const;
 	virtual double getProgress();
 	virtual double getRelativePowerError();
 	virtual int getMaximumPossibleCoefficientCount();
@@ -41,23 +71,37 @@ public:
 	ComplexFloating createComplexFloating(Complex<long double> const &value) const;
 
 private:
+	void checkScenarioBuses() const;
 	void calculateFirstCoefficient();
 	Vector<Floating, ComplexFloating> calculateFirstCoefficientInternal();
 	bool isPQCoefficientZero(Vector<Floating, ComplexFloating> const& coefficients) const;
 	void calculateSecondCoefficient();
-	ComplexFloating calculateRightHandSide(PVBus const& bus);
-	void calculateNextCoefficient();
-	double calculatePowerError() const;
-	double calculateVoltageError() const;
-	double calculateTotalRelativeError() const;
+	ComplexFloating calculateRightHandSide(int scenario, PVBus const& bus);
+	void calculateNextCoefficient(std::vector<int> const &scenarios);
+	void resizeCoefficientBuffers(size_t count);
+	void solveMultiple(std::vector<int> const &scenarios);
+	double calculatePowerError(int scenario, bool sentinelsOnly) const;
+	double calculateVoltageError(int scenario, bool sentinelsOnly) const;
+	double calculateTotalRelativeError(int scenario, bool sentinelsOnly) const;
+	bool isContinuationStep(int scenario) const;
+	bool areSentinelsUsed() const;
+	void updateContinuedNodes();
+	bool isConverged(double totalError) const;
 	void freeMemory();
 	void deleteContinuations();
-	void calculateVoltagesFromCoefficients();
-	void getVoltagesAsVectorComplexFloating(Vector<Floating, ComplexFloating> &result) const;
-	void updateProgress(double relativePowerError);
+	IAnalyticContinuation<Floating, ComplexFloating>* createContinuation(int scenario, int node) const;
+	IPreconditioner<Floating, ComplexFloating>* createPreconditioner() const;
+	void calculateVoltagesFromCoefficients(int scenario);
+	void completeVoltagesFromCoefficients(int scenario, int coefficientCount);
+	void getVoltagesAsVectorComplexFloating(int scenario, Vector<Floating, ComplexFloating> &result) const;
+	void updateMaximumPossibleCoefficientCount(int scenario);
+	void updateProgress(int scenario, double relativePowerError);
+	void updateRelativePowerError(int scenario, double relativePowerError);
+	void notifyProgress();
 
 private:
 	static Floating findMaximumMagnitude(const std::vector<ComplexFloating> &values);
+	static bool isStalledOrDiverging(std::vector<double> const &errors);
 
 private:
 	const double _targetPrecision;
@@ -66,20 +110,42 @@ private:
 	const int _pqBusCount;
 	const int _pvBusCount;
 	const double _nominalVoltage;
+	const int _scenarioCount;
 	const bool _iterativeSolver;
 	SparseMatrix<Floating, ComplexFloating> _admittances;
 	ILinearEquationSystemSolver<Floating, ComplexFloating> *_solver;
+	LUDecompositionSymbolic *_luSymbolic;
 	std::vector<ComplexFloating> _totalAdmittanceRowSums;
 	Vector<Floating, ComplexFloating> _constantCurrents;
-	std::vector<PQBus> _pqBuses;
-	std::vector<PVBus> _pvBuses;
-	std::vector< Complex<long double> > _voltages;
-	CoefficientStorage<ComplexFloating, Floating> *_coefficientStorage;
-	std::vector<AnalyticContinuation<Floating, ComplexFloating>*> _continuations;
+	std::vector< std::vector<PQBus> > _pqBuses;
+	std::vector< std::vector<PVBus> > _pvBuses;
+	std::vector< std::vector< Complex<long double> > > _voltages;
+	std::vector< std::vector< Complex<long double> > > _bestVoltages;
+	std::vector< std::vector<double> > _errorHistories;
+	std::vector<CoefficientStorage<ComplexFloating, Floating>*> _coefficientStorages;
+	std::vector< std::vector<IAnalyticContinuation<Floating, ComplexFloating>*> > _continuations;
+	std::vector<SolutionHistory<Floating, ComplexFloating>*> _solutionHistories;
+	std::vector<Vector<Floating, ComplexFloating>> _rightHandSides;
+	std::vector<Vector<Floating, ComplexFloating>> _solutions;
+	mutable Vector<Floating, ComplexFloating> _powerErrorCurrents;
+	mutable Vector<Floating, ComplexFloating> _powerErrorVoltages;
+	mutable Vector<Floating, ComplexFloating> _powerErrorPowers;
 	ComplexFloating _embeddingModification;
+	int _continuationInterval;
+	AnalyticContinuationMethod _analyticContinuationMethod;
+	BiCGSTABPreconditioner _preconditioner;
+	int _solutionHistoryLength;
+	double _iterativeSolverTolerance;
+	std::vector<int> _sentinelNodes;
+	std::vector<bool> _isSentinel;
+	std::vector<int> _continuedNodes;
+	std::vector<bool> _isContinued;
 	std::mutex _progressMutex;
 	double _progress;
 	double _relativePowerError;
+	std::vector<double> _relativePowerErrors;
 	int _maximumPossibleCoefficientCount;
+	ProgressCallback _progressCallback;
+	int _progressCallbackCalculatorId;
 };
 
@@ -0,0 +1,14 @@
+#include "CalculatorDouble.h"
+
+CalculatorDouble::CalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver) :
+	Calculator<double, Complex<double>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver)
+{ }
+
+CalculatorDouble::CalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver) :
+	Calculator<double, Complex<double>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver)
+{ }
+
+double CalculatorDouble::createFloating(double value) const
+{
+	return value;
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Calculator.h"
+
+class CalculatorDouble :
+	public Calculator< double, Complex<double> >
+{
+public:
+	CalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	CalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver);
+	
+public:
+	virtual double createFloating(double value) const;
+};
+
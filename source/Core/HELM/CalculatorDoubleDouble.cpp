@@ -0,0 +1,14 @@
+#include "CalculatorDoubleDouble.h"
+
+CalculatorDoubleDouble::CalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver) :
+	Calculator<DoubleDouble, Complex<DoubleDouble>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver)
+{ }
+
+CalculatorDoubleDouble::CalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver) :
+	Calculator<DoubleDouble, Complex<DoubleDouble>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver)
+{ }
+
+DoubleDouble CalculatorDoubleDouble::createFloating(double value) const
+{
+	return DoubleDouble(value);
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Calculator.h"
+
+class CalculatorDoubleDouble :
+	public Calculator< DoubleDouble, Complex<DoubleDouble> >
+{
+public:
+	CalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	CalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver);
+	
+public:
+	virtual DoubleDouble createFloating(double value) const;
+};
+
@@ -4,6 +4,10 @@ CalculatorLongDouble::CalculatorLongDouble(double targetPrecision, int numberOfC
 	Calculator<long double, Complex<long double>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver)
 { }
 
+CalculatorLongDouble::CalculatorLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver) :
+	Calculator<long double, Complex<long double>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver)
+{ }
+
 long double CalculatorLongDouble::createFloating(double value) const
 {
 	return static_cast<long double>(value);
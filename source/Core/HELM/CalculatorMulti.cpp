@@ -1,13 +1,23 @@
 #include "CalculatorMulti.h"
+#include "MultiPrecisionScope.h"
 #include <assert.h>
 
 CalculatorMulti::CalculatorMulti(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, bool iterativeSolver) :
-	Calculator< MultiPrecision, Complex<MultiPrecision> >(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver),
+	CalculatorMulti(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, bitPrecision, 1, iterativeSolver)
+{ }
+
+CalculatorMulti::CalculatorMulti(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, int scenarioCount, bool iterativeSolver) :
+	Calculator< MultiPrecision, Complex<MultiPrecision> >(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver),
 	_bitPrecision(bitPrecision)
 {
 	assert(bitPrecision > 0);
-	// unfortunately necessary
-	MultiPrecision::setDefaultPrecision(bitPrecision);
+}
+
+// the temporaries of the calculation get the precision of this calculator, without affecting calculations in other threads
+bool CalculatorMulti::calculate(CancellationToken const &cancellationToken)
+{
+	MultiPrecisionScope scope(_bitPrecision);
+	return Calculator< MultiPrecision, Complex<MultiPrecision> >::calculate(cancellationToken);
 }
 
 MultiPrecision CalculatorMulti::createFloating(double value) const
@@ -9,8 +9,11 @@ class CalculatorMulti :
 {
 public:
 	CalculatorMulti(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, bool iterativeSolver);
+	CalculatorMulti(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, int scenarioCount, bool iterativeSolver);
 	
 public:
+	using Calculator< MultiPrecision, Complex<MultiPrecision> >::calculate;
+	virtual bool calculate(CancellationToken const &cancellationToken);
 	virtual MultiPrecision createFloating(double value) const;
 
 private:
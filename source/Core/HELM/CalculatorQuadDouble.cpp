@@ -0,0 +1,14 @@
+#include "CalculatorQuadDouble.h"
+
+CalculatorQuadDouble::CalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver) :
+	Calculator<QuadDouble, Complex<QuadDouble>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver)
+{ }
+
+CalculatorQuadDouble::CalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver) :
+	Calculator<QuadDouble, Complex<QuadDouble>>(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver)
+{ }
+
+QuadDouble CalculatorQuadDouble::createFloating(double value) const
+{
+	return QuadDouble(value);
+}
\ No newline at end of file
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "Calculator.h"
+
+class CalculatorQuadDouble :
+	public Calculator< QuadDouble, Complex<QuadDouble> >
+{
+public:
+	CalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	CalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver);
+	
+public:
+	virtual QuadDouble createFloating(double value) const;
+};
+
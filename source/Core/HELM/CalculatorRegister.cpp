@@ -4,70 +4,173 @@
 #include "Complex.h"
 #include "CalculatorLongDouble.h"
 #include "CalculatorMulti.h"
+#include "CalculatorDouble.h"
+#include "CalculatorDoubleDouble.h"
+#include "CalculatorQuadDouble.h"
 #include <limits>
+#include <thread>
+#include <algorithm>
 
 using namespace std;
 
+CalculatorRegister::CalculatorRegister() :
+	_nextShard(0),
+	_workerPool(0)
+{ }
+
+// the global register is destroyed while the loader lock is held, where joining the threads of the worker pool can deadlock,
+// therefore a worker pool, which was not stopped with shutdown before, is left to the end of the process
 CalculatorRegister::~CalculatorRegister(void)
 {
 	try
 	{
-		lock_guard<mutex> lock(_mutex);
-
-		for (map<int, ICalculator*>::iterator i = _calculators.begin(); i != _calculators.end(); ++i)
-			delete i->second;
+		for (auto i = 0; i < _shardCount; ++i)
+			_shards[i].cancelAll();
 	}
 	catch(...)
 	{ }
-
-	_calculators.clear();
 }
 
 ICalculator& CalculatorRegister::get(int id)
 {
-	lock_guard<mutex> lock(_mutex);
-
-	return *(_calculators.at(id));
+	return getShard(id).get(getSlot(id));
 }
 
 int CalculatorRegister::createCalculatorLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
 {
-	lock_guard<mutex> lock(_mutex);
+	return add(new CalculatorLongDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver));
+}
 
-	int id = findEmptyId();
+int CalculatorRegister::createCalculatorMultiPrecision(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, bool iterativeSolver)
+{
+	return add(new CalculatorMulti(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, bitPrecision, iterativeSolver));
+}
 
-	if (id >= 0)
-		_calculators.insert(pair<int, ICalculator*>(id, new CalculatorLongDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver)));
+int CalculatorRegister::createCalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
+{
+	return add(new CalculatorDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver));
+}
 
-	return id;
+int CalculatorRegister::createCalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
+{
+	return add(new CalculatorDoubleDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver));
 }
 
-int CalculatorRegister::createCalculatorMultiPrecision(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, bool iterativeSolver)
+int CalculatorRegister::createCalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
 {
-	lock_guard<mutex> lock(_mutex);
+	return add(new CalculatorQuadDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver));
+}
 
-	int id = findEmptyId();
+int CalculatorRegister::createCalculatorBatchLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver)
+{
+	return add(new CalculatorLongDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver));
+}
 
-	if (id >= 0)
-		_calculators.insert(pair<int, ICalculator*>(id, new CalculatorMulti(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, bitPrecision, iterativeSolver)));
+int CalculatorRegister::createCalculatorBatchMultiPrecision(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, int scenarioCount, bool iterativeSolver)
+{
+	return add(new CalculatorMulti(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, bitPrecision, scenarioCount, iterativeSolver));
+}
+
+// a running calculation is cancelled and awaited without holding the lock of the shard, because its callbacks might use the register
+void CalculatorRegister::remove(int calculator)
+{
+	CalculationJob *job;
+	auto removedCalculator = getShard(calculator).remove(getSlot(calculator), job);
+
+	if (job != 0)
+	{
+		job->cancel();
+		job->wait();
+		delete job;
+	}
 
-	return id;
+	delete removedCalculator;
 }
 
-int CalculatorRegister::findEmptyId() const
-{	
-	for (int i = 0; i < numeric_limits<int>::max(); ++i)
-		if (_calculators.count(i) == 0)
-			return i;
+void CalculatorRegister::calculateAsync(int id, CompletionCallback completionCallback)
+{
+	auto &workerPool = getWorkerPool();
+	auto &job = getShard(id).createJob(getSlot(id), id, completionCallback);
+	workerPool.enqueue(job);
+}
 
-	return -1;
+void CalculatorRegister::cancel(int id)
+{
+	auto job = getShard(id).findJob(getSlot(id));
+
+	if (job != 0)
+		job->cancel();
 }
 
-void CalculatorRegister::remove(int calculator)
+// the job stays registered until the next asynchronous calculation or the removal of the calculator,
+// therefore it is safe to wait for it outside of the lock as long as these happen in the same thread
+CalculationState CalculatorRegister::wait(int id)
 {
-	lock_guard<mutex> lock(_mutex);
+	auto job = getShard(id).findJob(getSlot(id));
+	return job == 0 ? CalculationStateIdle : job->wait();
+}
 
-	map<int, ICalculator*>::iterator iterator = _calculators.find(calculator);
-	delete iterator->second;
-	_calculators.erase(iterator);
+CalculationState CalculatorRegister::getCalculationState(int id)
+{
+	auto job = getShard(id).findJob(getSlot(id));
+	return job == 0 ? CalculationStateIdle : job->getState();
+}
+
+// the worker pool finishes the queued jobs before it stops, which is quick as all of them are cancelled,
+// it is deleted without holding the lock, because the completion callbacks might start new calculations,
+// the caller has to make sure that no other thread starts a calculation at the same time
+void CalculatorRegister::shutdown()
+{
+	for (auto i = 0; i < _shardCount; ++i)
+		_shards[i].cancelAll();
+
+	WorkerPool *workerPool;
+
+	{
+		lock_guard<mutex> lock(_workerPoolMutex);
+		workerPool = _workerPool;
+		_workerPool = 0;
+	}
+
+	delete workerPool;
+}
+
+// the shards are used round robin, therefore the calculators of one client are spread over all of them
+int CalculatorRegister::add(ICalculator *calculator)
+{
+	auto shard = static_cast<int>(_nextShard++ % _shardCount);
+	auto slot = _shards[shard].add(calculator);
+
+	if (slot > (numeric_limits<int>::max() - shard)/_shardCount)
+	{
+		CalculationJob *job;
+		delete _shards[shard].remove(slot, job);
+		return -1;
+	}
+
+	return slot*_shardCount + shard;
+}
+
+CalculatorRegisterShard& CalculatorRegister::getShard(int id)
+{
+	if (id < 0)
+		throw out_of_range("there is no calculator with this id");
+
+	return _shards[id % _shardCount];
+}
+
+// after a shutdown the next asynchronous calculation starts a new worker pool
+WorkerPool& CalculatorRegister::getWorkerPool()
+{
+	lock_guard<mutex> lock(_workerPoolMutex);
+
+	if (_workerPool == 0)
+		_workerPool = new WorkerPool(max(1, static_cast<int>(thread::hardware_concurrency())));
+
+	return *_workerPool;
+}
+
+int CalculatorRegister::getSlot(int id)
+{
+	return id/_shardCount;
 }
\ No newline at end of file
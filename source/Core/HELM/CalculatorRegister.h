@@ -2,24 +2,52 @@
 
 #include "ICalculator.h"
 #include "Calculator.h"
-#include <map>
+#include "CalculationJob.h"
+#include "CalculationState.h"
+#include "CompletionCallback.h"
+#include "CalculatorRegisterShard.h"
+#include "WorkerPool.h"
+#include <atomic>
 #include <mutex>
 
+// the calculators are spread over several shards, so that concurrent calls for different calculators rarely wait for the same lock,
+// the id of a calculator consists of its slot and its shard
 class CalculatorRegister
 {
 public:
+	CalculatorRegister();
 	~CalculatorRegister();
 
 	ICalculator& get(int id);
 	int createCalculatorLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
 	int createCalculatorMultiPrecision(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, bool iterativeSolver);
+	int createCalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	int createCalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	int createCalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver);
+	int createCalculatorBatchLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver);
+	int createCalculatorBatchMultiPrecision(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, int scenarioCount, bool iterativeSolver);
 	void remove(int id);
+	void calculateAsync(int id, CompletionCallback completionCallback);
+	void cancel(int id);
+	CalculationState wait(int id);
+	CalculationState getCalculationState(int id);
+	void shutdown();
 
 private:
-	int findEmptyId() const;
-	
+	int add(ICalculator *calculator);
+	CalculatorRegisterShard& getShard(int id);
+	WorkerPool& getWorkerPool();
+
+private:
+	static int getSlot(int id);
+
+private:
+	static const int _shardCount = 16;
+
 private:
-	std::map<int, ICalculator*> _calculators;
-	std::mutex _mutex;
+	CalculatorRegisterShard _shards[_shardCount];
+	std::atomic<unsigned int> _nextShard;
+	WorkerPool *_workerPool;
+	std::mutex _workerPoolMutex;
 };
 
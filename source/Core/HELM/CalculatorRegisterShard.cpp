@@ -0,0 +1,98 @@
+#include "CalculatorRegisterShard.h"
+#include "ICalculator.h"
+#include <stdexcept>
+
+using namespace std;
+
+CalculatorRegisterShard::CalculatorRegisterShard()
+{ }
+
+// without a shutdown of the worker pool a worker thread can still run a job, as the cancellation is only checked between two coefficients,
+// therefore such a job and its calculator are left to the end of the process instead of being freed below the running thread
+CalculatorRegisterShard::~CalculatorRegisterShard()
+{
+	for (size_t i = 0; i < _calculators.size(); ++i)
+	{
+		if (_jobs[i] != 0 && !CalculationJob::isFinal(_jobs[i]->getState()))
+			continue;
+
+		delete _jobs[i];
+		delete _calculators[i];
+	}
+}
+
+int CalculatorRegisterShard::add(ICalculator *calculator)
+{
+	lock_guard<mutex> lock(_mutex);
+
+	if (_freeSlots.empty())
+	{
+		_calculators.push_back(calculator);
+		_jobs.push_back(0);
+		return _calculators.size() - 1;
+	}
+
+	auto slot = _freeSlots.back();
+	_freeSlots.pop_back();
+	_calculators[slot] = calculator;
+	return slot;
+}
+
+ICalculator& CalculatorRegisterShard::get(int slot)
+{
+	lock_guard<mutex> lock(_mutex);
+
+	checkSlot(slot);
+	return *_calculators[slot];
+}
+
+ICalculator* CalculatorRegisterShard::remove(int slot, CalculationJob *&job)
+{
+	lock_guard<mutex> lock(_mutex);
+
+	checkSlot(slot);
+	auto calculator = _calculators[slot];
+	job = _jobs[slot];
+	_calculators[slot] = 0;
+	_jobs[slot] = 0;
+	_freeSlots.push_back(slot);
+	return calculator;
+}
+
+CalculationJob& CalculatorRegisterShard::createJob(int slot, int id, CompletionCallback completionCallback)
+{
+	lock_guard<mutex> lock(_mutex);
+
+	checkSlot(slot);
+	auto previousJob = _jobs[slot];
+
+	if (previousJob != 0 && !CalculationJob::isFinal(previousJob->getState()))
+		throw logic_error("the previous calculation is still in progress");
+
+	delete previousJob;
+	_jobs[slot] = new CalculationJob(*_calculators[slot], id, completionCallback);
+	return *_jobs[slot];
+}
+
+CalculationJob* CalculatorRegisterShard::findJob(int slot)
+{
+	lock_guard<mutex> lock(_mutex);
+
+	checkSlot(slot);
+	return _jobs[slot];
+}
+
+void CalculatorRegisterShard::cancelAll()
+{
+	lock_guard<mutex> lock(_mutex);
+
+	for (auto job : _jobs)
+		if (job != 0)
+			job->cancel();
+}
+
+void CalculatorRegisterShard::checkSlot(int slot) const
+{
+	if (slot < 0 || slot >= static_cast<int>(_calculators.size()) || _calculators[slot] == 0)
+		throw out_of_range("there is no calculator with this id");
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "CalculationJob.h"
+#include "CompletionCallback.h"
+#include <vector>
+#include <mutex>
+
+class ICalculator;
+
+// part of the handle table of the register, the slots of removed calculators are reused in the order of their removal
+class CalculatorRegisterShard
+{
+public:
+	CalculatorRegisterShard();
+	~CalculatorRegisterShard();
+
+	int add(ICalculator *calculator);
+	ICalculator& get(int slot);
+	ICalculator* remove(int slot, CalculationJob *&job);
+	CalculationJob& createJob(int slot, int id, CompletionCallback completionCallback);
+	CalculationJob* findJob(int slot);
+	void cancelAll();
+
+private:
+	CalculatorRegisterShard(CalculatorRegisterShard const &rhs);
+	void operator=(CalculatorRegisterShard const &rhs);
+
+	void checkSlot(int slot) const;
+
+private:
+	std::vector<ICalculator*> _calculators;
+	std::vector<CalculationJob*> _jobs;
+	std::vector<int> _freeSlots;
+	std::mutex _mutex;
+};
\ No newline at end of file
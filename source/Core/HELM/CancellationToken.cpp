@@ -0,0 +1,15 @@
+#include "CancellationToken.h"
+
+CancellationToken::CancellationToken() :
+	_cancellationRequested(false)
+{ }
+
+void CancellationToken::cancel()
+{
+	_cancellationRequested = true;
+}
+
+bool CancellationToken::isCancellationRequested() const
+{
+	return _cancellationRequested;
+}
\ No newline at end of file
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <atomic>
+
+// shared between the thread which runs a calculation and the one which wants to stop it,
+// the calculation checks the token only between two coefficients
+class CancellationToken
+{
+public:
+	CancellationToken();
+
+	void cancel();
+	bool isCancellationRequested() const;
+
+private:
+	CancellationToken(CancellationToken const &rhs);
+	void operator=(CancellationToken const &rhs);
+
+private:
+	std::atomic<bool> _cancellationRequested;
+};
\ No newline at end of file
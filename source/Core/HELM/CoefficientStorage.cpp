@@ -1,51 +1,123 @@
 #include "CoefficientStorage.h"
 #include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "Complex.h"
 #include "NumericalTraits.h"
 #include <assert.h>
 #include <stdexcept>
+#include <utility>
 
 using namespace std;
 
 template class CoefficientStorage< Complex<long double>, long double >;
 template class CoefficientStorage< Complex<MultiPrecision>, MultiPrecision >;
+template class CoefficientStorage< Complex<DoubleDouble>, DoubleDouble >;
+template class CoefficientStorage< Complex<QuadDouble>, QuadDouble >;
+template class CoefficientStorage< Complex<double>, double >;
 
 template<typename ComplexType, typename RealType>
 CoefficientStorage<ComplexType, RealType>::CoefficientStorage(int maximumNumberOfCoefficients, int nodeCount, vector<PQBus> const& pqBuses, vector<PVBus> const &pvBuses, SparseMatrix<RealType, ComplexType> const& admittances) :
+	CoefficientStorage(maximumNumberOfCoefficients, nodeCount, pqBuses, pvBuses, admittances, CoefficientStorageLayoutNodeMajor)
+{ }
+
+template<typename ComplexType, typename RealType>
+CoefficientStorage<ComplexType, RealType>::CoefficientStorage(int maximumNumberOfCoefficients, int nodeCount, vector<PQBus> const& pqBuses, vector<PVBus> const &pvBuses, SparseMatrix<RealType, ComplexType> const& admittances, CoefficientStorageLayout layout) :
+	_maximumNumberOfCoefficients(maximumNumberOfCoefficients),
 	_nodeCount(nodeCount),
 	_pqBusCount(pqBuses.size()),
 	_pvBusCount(pvBuses.size()),
-	_admittances(admittances)
+	_layout(layout),
+	_admittances(admittances),
+	_coefficientCount(0),
+	_coefficients(nodeCount*maximumNumberOfCoefficients),
+	_pqBusIndices(nodeCount, -1),
+	_inverseCoefficients(_pqBusCount*maximumNumberOfCoefficients),
+	_pvBusIndices(nodeCount, -1),
+	_squaredCoefficients(_pvBusCount*maximumNumberOfCoefficients),
+	_combinedCoefficients(_pvBusCount*maximumNumberOfCoefficients),
+	_weightedCoefficients(_pvBusCount*maximumNumberOfCoefficients),
+	_inverseConvolution(maximumNumberOfCoefficients, _pqBusCount),
+	_squaredConvolution(maximumNumberOfCoefficients, _pvBusCount),
+	_combinedConvolution(maximumNumberOfCoefficients, _pvBusCount)
 {
 	assert(nodeCount ==_pqBusCount + _pvBusCount);
-	_coefficients.reserve(maximumNumberOfCoefficients);
+	assert(maximumNumberOfCoefficients > 0);
 
 	_pqBuses.reserve(_pqBusCount);
 	for (auto i = 0; i < _pqBusCount; ++i)
 	{
 		auto id = pqBuses[i].getId();
-		_inverseCoefficients.insert(pair<int, vector<ComplexType> >(id, vector<ComplexType>()));
 		_pqBuses.push_back(id);
+		_pqBusIndices[id] = i;
 	}
 
 	_pvBuses.reserve(_pvBusCount);
+	_pvBusVoltageMagnitudeSquares.reserve(_pvBusCount);
 	for (auto i = 0; i < _pvBusCount; ++i)
 	{
 		PVBus const& bus = pvBuses[i];
 		auto id = bus.getId();
 		auto voltageMagnitude = bus.getVoltageMagnitude();
-		_squaredCoefficients.insert(pair<int, vector<ComplexType> >(id, vector<ComplexType>()));
-		_combinedCoefficients.insert(pair<int, vector<ComplexType> >(id, vector<ComplexType>()));
-		_weightedCoefficients.insert(pair<int, vector<ComplexType> >(id, vector<ComplexType>()));
 		_pvBuses.push_back(id);
-		_pvBusVoltageMagnitudeSquares.insert(pair<int, RealType>(id, RealType(voltageMagnitude*voltageMagnitude)));
+		_pvBusIndices[id] = i;
+		_pvBusVoltageMagnitudeSquares.push_back(RealType(voltageMagnitude*voltageMagnitude));
 	}
 }
 
 template<typename ComplexType, typename RealType>
 void CoefficientStorage<ComplexType, RealType>::addCoefficients(Vector<RealType, ComplexType> const &coefficients)
 {
-	_coefficients.push_back(coefficients);
+	checkCoefficientCount();
+	auto step = _coefficientCount;
+
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _nodeCount; ++i)
+			_coefficients[getPosition(i, step, _nodeCount)] = coefficients(i);
+	}
+
+	calculateDerivedCoefficients();
+}
+
+// for multi precision values the limbs are exchanged with the ones of the storage, which saves copying them
+template<typename ComplexType, typename RealType>
+void CoefficientStorage<ComplexType, RealType>::addCoefficients(Vector<RealType, ComplexType> &&coefficients)
+{
+	checkCoefficientCount();
+	auto step = _coefficientCount;
+
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _nodeCount; ++i)
+			_coefficients[getPosition(i, step, _nodeCount)] = std::move(coefficients(i));
+	}
+
+	calculateDerivedCoefficients();
+}
+
+template<typename ComplexType, typename RealType>
+void CoefficientStorage<ComplexType, RealType>::checkCoefficientCount() const
+{
+	if (_coefficientCount >= _maximumNumberOfCoefficients)
+		throw range_error("maximum number of coefficients exceeded");
+}
+
+template<typename ComplexType, typename RealType>
+void CoefficientStorage<ComplexType, RealType>::calculateDerivedCoefficients()
+{
+	++_coefficientCount;
 	calculateNextInverseCoefficients();
 	calculateNextSquaredCoefficients();
 	calculateNextWeightedCoefficients();
@@ -55,147 +127,184 @@ void CoefficientStorage<ComplexType, RealType>::addCoefficients(Vector<RealType,
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getCoefficient(int node, int step) const
 {
-	return _coefficients[step](node);
+	assert(step < _coefficientCount);
+	return _coefficients[getPosition(node, step, _nodeCount)];
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getLastCoefficient(int node) const
 {
-	assert(_coefficients.size() > 0);
-	return getCoefficient(node, _coefficients.size() - 1);
+	assert(_coefficientCount > 0);
+	return getCoefficient(node, _coefficientCount - 1);
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getInverseCoefficient(int node, int step) const
 {
-	assert(_inverseCoefficients.count(node) == 1);
-	return _inverseCoefficients.at(node)[step];
+	assert(_pqBusIndices[node] >= 0);
+	assert(step < _coefficientCount);
+	return _inverseCoefficients[getPosition(_pqBusIndices[node], step, _pqBusCount)];
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getLastInverseCoefficient(int node) const
 {
-	assert(_coefficients.size() > 0);
-	return getInverseCoefficient(node, _coefficients.size() - 1);
+	assert(_coefficientCount > 0);
+	return getInverseCoefficient(node, _coefficientCount - 1);
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getSquaredCoefficient(int node, int step) const
 {
-	assert(_squaredCoefficients.count(node) == 1);
-	return _squaredCoefficients.at(node)[step];
+	assert(_pvBusIndices[node] >= 0);
+	assert(step < _coefficientCount);
+	return _squaredCoefficients[getPosition(_pvBusIndices[node], step, _pvBusCount)];
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getLastSquaredCoefficient(int node) const
 {
-	assert(_coefficients.size() > 0);
-	return getSquaredCoefficient(node, _coefficients.size() - 1);
+	assert(_coefficientCount > 0);
+	return getSquaredCoefficient(node, _coefficientCount - 1);
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getWeightedCoefficient(int node, int step) const
 {
-	assert(_weightedCoefficients.count(node) == 1);
-	return _weightedCoefficients.at(node)[step];
+	assert(_pvBusIndices[node] >= 0);
+	assert(step < _coefficientCount);
+	return _weightedCoefficients[getPosition(_pvBusIndices[node], step, _pvBusCount)];
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getCombinedCoefficient(int node, int step) const
 {
-	assert(_squaredCoefficients.count(node) == 1);
-	return _combinedCoefficients.at(node)[step];
+	assert(_pvBusIndices[node] >= 0);
+	assert(step < _coefficientCount);
+	return _combinedCoefficients[getPosition(_pvBusIndices[node], step, _pvBusCount)];
 }
 
 template<typename ComplexType, typename RealType>
 ComplexType const& CoefficientStorage<ComplexType, RealType>::getLastCombinedCoefficient(int node) const
 {
-	assert(_coefficients.size() > 0);
-	return getCombinedCoefficient(node, _coefficients.size() - 1);
+	assert(_coefficientCount > 0);
+	return getCombinedCoefficient(node, _coefficientCount - 1);
 }
 
 template<typename ComplexType, typename RealType>
 int CoefficientStorage<ComplexType, RealType>::getCoefficientCount() const
 {
-	return _coefficients.size();
+	return _coefficientCount;
+}
+
+template<typename ComplexType, typename RealType>
+CoefficientStorageLayout CoefficientStorage<ComplexType, RealType>::getLayout() const
+{
+	return _layout;
 }
 
 template<typename ComplexType, typename RealType>
 void CoefficientStorage<ComplexType, RealType>::calculateNextInverseCoefficients()
 {
-	if (_coefficients.size() == 1)
+	if (_coefficientCount == 1)
 	{
 		calculateFirstInverseCoefficients();
 		return;
 	}
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _pqBusCount; ++i)
-		calculateNextInverseCoefficient(_pqBuses[i]);
-}
-
-template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::calculateNextInverseCoefficient(int node)
-{
-	ComplexType result(RealType(0));
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
 
-	int n = _coefficients.size() - 1;
-	for (auto i = 0; i < n; ++i)
+	#pragma omp parallel
 	{
-		ComplexType const& coefficient = getCoefficient(node, n - i);
-		ComplexType const& inverseCoefficient = getInverseCoefficient(node, i);
-		result += coefficient*inverseCoefficient;
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pqBusCount; ++i)
+			calculateNextInverseCoefficient(i);
 	}
+}
 
-	ComplexType const& firstCoefficient = getCoefficient(node, 0);
-	result = result/firstCoefficient*ComplexType(RealType(-1));
-	insertInverseCoefficient(node, result);
+template<typename ComplexType, typename RealType>
+void CoefficientStorage<ComplexType, RealType>::calculateNextInverseCoefficient(int pqBus)
+{
+	auto const coefficients = &_coefficients[getPosition(_pqBuses[pqBus], 0, _nodeCount)];
+	auto const inverseCoefficients = &_inverseCoefficients[getPosition(pqBus, 0, _pqBusCount)];
+	auto const coefficientDistance = getStepDistance(_nodeCount);
+	auto const inverseCoefficientDistance = getStepDistance(_pqBusCount);
+
+	int n = _coefficientCount - 1;
+	ComplexType const& sum = _inverseConvolution.calculateNextCoefficient(pqBus, n, coefficients, coefficientDistance, inverseCoefficients, inverseCoefficientDistance);
+	ComplexType const& firstCoefficient = coefficients[0];
+	auto result = sum/firstCoefficient*ComplexType(RealType(-1));
+	insertInverseCoefficient(pqBus, result);
 }
 
 template<typename ComplexType, typename RealType>
 void CoefficientStorage<ComplexType, RealType>::calculateFirstInverseCoefficients()
 {
-	#pragma omp parallel for
-	for (auto i = 0; i < _pqBusCount; ++i)
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
 	{
-		auto node = _pqBuses[i];
-		ComplexType const& coefficient = getCoefficient(node, 0);
-		auto inverseCoefficient = ComplexType(RealType(1))/coefficient;
-		insertInverseCoefficient(node, inverseCoefficient);
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pqBusCount; ++i)
+		{
+			ComplexType const& coefficient = getCoefficient(_pqBuses[i], 0);
+			auto inverseCoefficient = ComplexType(RealType(1))/coefficient;
+			insertInverseCoefficient(i, inverseCoefficient);
+		}
 	}
 }
+
 template<typename ComplexType, typename RealType>
 void CoefficientStorage<ComplexType, RealType>::calculateNextSquaredCoefficients()
 {
-	#pragma omp parallel for
-	for (auto i = 0; i < _pvBusCount; ++i)
-		calculateNextSquaredCoefficient(_pvBuses[i]);
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pvBusCount; ++i)
+			calculateNextSquaredCoefficient(i);
+	}
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::calculateNextSquaredCoefficient(int node)
+void CoefficientStorage<ComplexType, RealType>::calculateNextSquaredCoefficient(int pvBus)
 {
-	int n = _coefficients.size() - 1;
-	ComplexType coefficient;
-
-	for (auto j = 0; j <= n; ++j)
-		coefficient += getCoefficient(node, j)*getCoefficient(node, n - j);
+	int n = _coefficientCount - 1;
+	auto const coefficients = &_coefficients[getPosition(_pvBuses[pvBus], 0, _nodeCount)];
+	auto const distance = getStepDistance(_nodeCount);
+	auto coefficient = _squaredConvolution.calculateNextCoefficient(pvBus, n, coefficients, distance, coefficients, distance);
+	coefficient.addProduct(coefficients[0], coefficients[n*distance]);
 
-	insertSquaredCoefficient(node, coefficient);
+	insertSquaredCoefficient(pvBus, coefficient);
 }
 
 template<typename ComplexType, typename RealType>
 void CoefficientStorage<ComplexType, RealType>::calculateNextWeightedCoefficients()
 {
-	#pragma omp parallel for
-	for (auto i = 0; i < _pvBusCount; ++i)
-		calculateNextWeightedCoefficient(_pvBuses[i]);
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pvBusCount; ++i)
+			calculateNextWeightedCoefficient(i);
+	}
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::calculateNextWeightedCoefficient(int node)
+void CoefficientStorage<ComplexType, RealType>::calculateNextWeightedCoefficient(int pvBus)
 {
 	ComplexType coefficient;
+	auto node = _pvBuses[pvBus];
 	
 	for (auto i = _admittances.getRowIterator(node); i.isValid(); i.next())
 	{
@@ -207,58 +316,79 @@ void CoefficientStorage<ComplexType, RealType>::calculateNextWeightedCoefficient
 		coefficient += conj(i.getValue()*getLastCoefficient(column));
 	}
 
-	insertWeightedCoefficent(node, coefficient);
+	insertWeightedCoefficent(pvBus, coefficient);
 }
 
 template<typename ComplexType, typename RealType>
 void CoefficientStorage<ComplexType, RealType>::calculateNextCombinedCoefficients()
 {
-	#pragma omp parallel for
-	for (auto i = 0; i < _pvBusCount; ++i)
-		calculateNextCombinedCoefficient(_pvBuses[i]);
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _pvBusCount; ++i)
+			calculateNextCombinedCoefficient(i);
+	}
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::calculateNextCombinedCoefficient(int node)
+void CoefficientStorage<ComplexType, RealType>::calculateNextCombinedCoefficient(int pvBus)
 {
-	ComplexType result;
-	int n = _coefficients.size() - 1;
-
-	for (auto i = 0; i <= n; ++i)
-			result += getWeightedCoefficient(node, n - i)*getSquaredCoefficient(node, i);
+	int n = _coefficientCount - 1;
+	auto node = _pvBuses[pvBus];
+	auto const weightedCoefficients = &_weightedCoefficients[getPosition(pvBus, 0, _pvBusCount)];
+	auto const squaredCoefficients = &_squaredCoefficients[getPosition(pvBus, 0, _pvBusCount)];
+	auto const distance = getStepDistance(_pvBusCount);
+	auto result = _combinedConvolution.calculateNextCoefficient(pvBus, n, weightedCoefficients, distance, squaredCoefficients, distance);
+	result.addProduct(weightedCoefficients[0], squaredCoefficients[n*distance]);
 	
-	result += conj(_admittances(node, node))*getLastCoefficient(node)*ComplexType(_pvBusVoltageMagnitudeSquares[node]);
-	insertCombinedCoefficient(node, result);
+	result += conj(_admittances(node, node))*getLastCoefficient(node)*ComplexType(_pvBusVoltageMagnitudeSquares[pvBus]);
+	insertCombinedCoefficient(pvBus, result);
+}
+
+// the coefficients of one node respectively bus are contiguous for the node major layout, the coefficients of one step for the step major layout
+template<typename ComplexType, typename RealType>
+int CoefficientStorage<ComplexType, RealType>::getPosition(int index, int step, int count) const
+{
+	if (_layout == CoefficientStorageLayoutNodeMajor)
+		return index*_maximumNumberOfCoefficients + step;
+	else
+		return step*count + index;
+}
+
+template<typename ComplexType, typename RealType>
+int CoefficientStorage<ComplexType, RealType>::getStepDistance(int count) const
+{
+	return _layout == CoefficientStorageLayoutNodeMajor ? 1 : count;
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::insertInverseCoefficient(int node, ComplexType const& value)
+void CoefficientStorage<ComplexType, RealType>::insertInverseCoefficient(int pqBus, ComplexType const& value)
 {
-	assert(_inverseCoefficients.count(node) == 1);
 	assert(isValueFinite(std::abs2(value)));
-	_inverseCoefficients[node].push_back(value);
+	_inverseCoefficients[getPosition(pqBus, _coefficientCount - 1, _pqBusCount)] = value;
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::insertSquaredCoefficient(int node, ComplexType const& value)
+void CoefficientStorage<ComplexType, RealType>::insertSquaredCoefficient(int pvBus, ComplexType const& value)
 {
-	assert(_squaredCoefficients.count(node) == 1);
 	assert(isValueFinite(std::abs2(value)));
-	_squaredCoefficients[node].push_back(value);
+	_squaredCoefficients[getPosition(pvBus, _coefficientCount - 1, _pvBusCount)] = value;
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::insertCombinedCoefficient(int node, ComplexType const& value)
+void CoefficientStorage<ComplexType, RealType>::insertCombinedCoefficient(int pvBus, ComplexType const& value)
 {
-	assert(_combinedCoefficients.count(node) == 1);
 	assert(isValueFinite(std::abs2(value)));
-	_combinedCoefficients[node].push_back(value);
+	_combinedCoefficients[getPosition(pvBus, _coefficientCount - 1, _pvBusCount)] = value;
 }
 
 template<typename ComplexType, typename RealType>
-void CoefficientStorage<ComplexType, RealType>::insertWeightedCoefficent(int node, ComplexType const& value)
+void CoefficientStorage<ComplexType, RealType>::insertWeightedCoefficent(int pvBus, ComplexType const& value)
 {
-	assert(_weightedCoefficients.count(node) == 1);
 	assert(isValueFinite(std::abs2(value)));
-	_weightedCoefficients[node].push_back(value);
+	_weightedCoefficients[getPosition(pvBus, _coefficientCount - 1, _pvBusCount)] = value;
 }
\ No newline at end of file
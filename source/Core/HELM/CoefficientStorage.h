@@ -1,19 +1,23 @@
 #pragma once
 
 #include <vector>
-#include <map>
 #include "PQBus.h"
 #include "PVBus.h"
 #include "SparseMatrix.h"
 #include "Vector.h"
+#include "CoefficientStorageLayout.h"
+#include "RelaxedConvolution.h"
 
 template<typename ComplexType, typename RealType>
 class CoefficientStorage
 {
 public:
 	CoefficientStorage(int maximumNumberOfCoefficients, int nodeCount, std::vector<PQBus> const& pqBuses, std::vector<PVBus> const &pvBuses, SparseMatrix<RealType, ComplexType> const& admittances);
+	CoefficientStorage(int maximumNumberOfCoefficients, int nodeCount, std::vector<PQBus> const& pqBuses, std::vector<PVBus> const &pvBuses, SparseMatrix<RealType, ComplexType> const& admittances, CoefficientStorageLayout layout);
 
 	void addCoefficients(Vector<RealType, ComplexType> const &coefficients);
+	// takes over the values, therefore the content of the coefficients is unspecified afterwards
+	void addCoefficients(Vector<RealType, ComplexType> &&coefficients);
 	ComplexType const& getCoefficient(int node, int step) const;
 	ComplexType const& getLastCoefficient(int node) const;
 	ComplexType const& getInverseCoefficient(int node, int step) const;
@@ -24,34 +28,47 @@ public:
 	ComplexType const& getCombinedCoefficient(int node, int step) const;
 	ComplexType const& getLastCombinedCoefficient(int node) const;
 	int getCoefficientCount() const;
+	CoefficientStorageLayout getLayout() const;
 
 private:
+	void checkCoefficientCount() const;
+	void calculateDerivedCoefficients();
 	void calculateNextInverseCoefficients();
-	void calculateNextInverseCoefficient(int node);
+	void calculateNextInverseCoefficient(int pqBus);
 	void calculateFirstInverseCoefficients();
 	void calculateNextSquaredCoefficients();
-	void calculateNextSquaredCoefficient(int node);
+	void calculateNextSquaredCoefficient(int pvBus);
 	void calculateNextCombinedCoefficients();
-	void calculateNextCombinedCoefficient(int node);
+	void calculateNextCombinedCoefficient(int pvBus);
 	void calculateNextWeightedCoefficients();
-	void calculateNextWeightedCoefficient(int node);
-	void insertInverseCoefficient(int node, ComplexType const& value);
-	void insertSquaredCoefficient(int node, ComplexType const& value);
-	void insertCombinedCoefficient(int node, ComplexType const& value);
-	void insertWeightedCoefficent(int node, ComplexType const& value);
+	void calculateNextWeightedCoefficient(int pvBus);
+	int getPosition(int index, int step, int count) const;
+	int getStepDistance(int count) const;
+	void insertInverseCoefficient(int pqBus, ComplexType const& value);
+	void insertSquaredCoefficient(int pvBus, ComplexType const& value);
+	void insertCombinedCoefficient(int pvBus, ComplexType const& value);
+	void insertWeightedCoefficent(int pvBus, ComplexType const& value);
 
 private:
+	const int _maximumNumberOfCoefficients;
 	const int _nodeCount;
 	const int _pqBusCount;
 	const int _pvBusCount;
+	const CoefficientStorageLayout _layout;
 	SparseMatrix<RealType, ComplexType> const& _admittances;
-	std::vector< Vector<RealType, ComplexType> > _coefficients;
-	std::map<int, std::vector<ComplexType> > _inverseCoefficients;
+	int _coefficientCount;
+	std::vector<ComplexType> _coefficients;
 	std::vector<int> _pqBuses;
-	std::map<int, std::vector<ComplexType> > _squaredCoefficients;
-	std::map<int, std::vector<ComplexType> > _combinedCoefficients;
-	std::map<int, std::vector<ComplexType> > _weightedCoefficients;
+	std::vector<int> _pqBusIndices;
+	std::vector<ComplexType> _inverseCoefficients;
 	std::vector<int> _pvBuses;
-	std::map<int, RealType> _pvBusVoltageMagnitudeSquares;
+	std::vector<int> _pvBusIndices;
+	std::vector<ComplexType> _squaredCoefficients;
+	std::vector<ComplexType> _combinedCoefficients;
+	std::vector<ComplexType> _weightedCoefficients;
+	std::vector<RealType> _pvBusVoltageMagnitudeSquares;
+	RelaxedConvolution<ComplexType, RealType> _inverseConvolution;
+	RelaxedConvolution<ComplexType, RealType> _squaredConvolution;
+	RelaxedConvolution<ComplexType, RealType> _combinedConvolution;
 };
 
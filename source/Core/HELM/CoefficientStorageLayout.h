@@ -0,0 +1,7 @@
+#pragma once
+
+enum CoefficientStorageLayout
+{
+	CoefficientStorageLayoutNodeMajor,
+	CoefficientStorageLayoutStepMajor
+};
\ No newline at end of file
@@ -0,0 +1,4 @@
+#pragma once
+
+// the state is one of CalculationState
+typedef void (__stdcall * CompletionCallback)(int calculator, int state);
\ No newline at end of file
@@ -1,8 +1,12 @@
 #include "Complex.h"
+#include <assert.h>
+#include <utility>
 
 template class Complex<double>;
 template class Complex<long double>;
 template class Complex<MultiPrecision>;
+template class Complex<DoubleDouble>;
+template class Complex<QuadDouble>;
 
 template<typename T>
 Complex<T>::Complex() :
@@ -22,6 +26,12 @@ Complex<T>::Complex(T const& real) :
 	_imag(static_cast<T>(0))
 { }
 
+template<typename T>
+Complex<T>::Complex(Complex<T> const& rhs) :
+	_real(rhs.real()),
+	_imag(rhs.imag())
+{ }
+
 template<typename T>
 T const& Complex<T>::real() const
 {
@@ -42,6 +52,14 @@ Complex<T>& Complex<T>::operator=(Complex<T> const& rhs)
 	return *this;
 }
 
+template<typename T>
+Complex<T>& Complex<T>::operator=(Complex<T>&& rhs)
+{
+	_real = std::move(rhs._real);
+	_imag = std::move(rhs._imag);
+	return *this;
+}
+
 template<typename T>
 Complex<T>& Complex<T>::operator+=(Complex<T> const& rhs)
 {
@@ -61,7 +79,7 @@ Complex<T>& Complex<T>::operator-=(Complex<T> const& rhs)
 template<typename T>
 Complex<T>& Complex<T>::operator*=(Complex<T> const& rhs)
 {
-	*this = *this * rhs;
+	assignProduct(*this, rhs);
 	return *this;
 }
 
@@ -72,6 +90,65 @@ Complex<T>& Complex<T>::operator/=(Complex<T> const& rhs)
 	return *this;
 }
 
+template<typename T>
+void Complex<T>::assignProduct(Complex<T> const& lhs, Complex<T> const& rhs)
+{
+	*this = lhs*rhs;
+}
+
+template<typename T>
+void Complex<T>::addProduct(Complex<T> const& lhs, Complex<T> const& rhs)
+{
+	*this += lhs*rhs;
+}
+
+template<typename T>
+void Complex<T>::subtractProduct(Complex<T> const& lhs, Complex<T> const& rhs)
+{
+	*this -= lhs*rhs;
+}
+
+// the parts of the result are buffered in the thread local pool, because this might be one of the factors
+template<>
+void Complex<MultiPrecision>::assignProduct(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs)
+{
+	auto &real = MultiPrecision::getScratch(0);
+	auto &imag = MultiPrecision::getScratch(1);
+	real.assignProduct(lhs.real(), rhs.real());
+	real.subtractProduct(lhs.imag(), rhs.imag());
+	imag.assignProduct(lhs.imag(), rhs.real());
+	imag.addProduct(lhs.real(), rhs.imag());
+	_real = real;
+	_imag = imag;
+}
+
+template<>
+void Complex<MultiPrecision>::addProduct(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs)
+{
+	assert(this != &lhs && this != &rhs);
+	_real.addProduct(lhs.real(), rhs.real());
+	_real.subtractProduct(lhs.imag(), rhs.imag());
+	_imag.addProduct(lhs.imag(), rhs.real());
+	_imag.addProduct(lhs.real(), rhs.imag());
+}
+
+template<>
+void Complex<MultiPrecision>::subtractProduct(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs)
+{
+	assert(this != &lhs && this != &rhs);
+	_real.subtractProduct(lhs.real(), rhs.real());
+	_real.addProduct(lhs.imag(), rhs.imag());
+	_imag.subtractProduct(lhs.imag(), rhs.real());
+	_imag.subtractProduct(lhs.real(), rhs.imag());
+}
+
+const Complex<MultiPrecision> operator*(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs)
+{
+	Complex<MultiPrecision> result;
+	result.assignProduct(lhs, rhs);
+	return result;
+}
+
 double toDouble(double value)
 {
 	return value;
@@ -4,6 +4,8 @@
 #include <sstream>
 #include <string>
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 
 template<typename T>
 class Complex
@@ -12,21 +14,35 @@ public:
 	Complex();
 	Complex(T const& real, T const& imag);
 	explicit Complex(T const& real);
+	Complex(Complex<T> const& rhs);
 
 	T const& real() const;
 	T const& imag() const;
 	
 	Complex<T>& operator=(Complex<T> const& rhs);
+	Complex<T>& operator=(Complex<T>&& rhs);
 	Complex<T>& operator+=(Complex<T> const& rhs);
 	Complex<T>& operator-=(Complex<T> const& rhs);
 	Complex<T>& operator*=(Complex<T> const& rhs);
 	Complex<T>& operator/=(Complex<T> const& rhs);
+	// fused kernels for the multiply add patterns of the matrix operations and the convolutions
+	void assignProduct(Complex<T> const& lhs, Complex<T> const& rhs);
+	void addProduct(Complex<T> const& lhs, Complex<T> const& rhs);
+	void subtractProduct(Complex<T> const& lhs, Complex<T> const& rhs);
 
 private:
 	T _real;
 	T _imag;
 };
 
+// these avoid the temporaries of the generic operators, as every temporary of MultiPrecision is a heap allocation
+template<>
+void Complex<MultiPrecision>::assignProduct(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs);
+template<>
+void Complex<MultiPrecision>::addProduct(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs);
+template<>
+void Complex<MultiPrecision>::subtractProduct(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs);
+
 template<typename T>
 const Complex<T> operator+(Complex<T> const& lhs, Complex<T> const& rhs)
 {
@@ -45,6 +61,8 @@ const Complex<T> operator*(Complex<T> const& lhs, Complex<T> const& rhs)
 	return Complex<T>(lhs.real()*rhs.real() - lhs.imag()*rhs.imag(), lhs.imag()*rhs.real() + lhs.real()*rhs.imag());
 }
 
+const Complex<MultiPrecision> operator*(Complex<MultiPrecision> const& lhs, Complex<MultiPrecision> const& rhs);
+
 template<typename T>
 const Complex<T> operator/(Complex<T> const& lhs, Complex<T> const& rhs)
 {
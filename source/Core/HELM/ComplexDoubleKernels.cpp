@@ -0,0 +1,248 @@
+#include "ComplexDoubleKernels.h"
+#include "ErrorFreeTransformations.h"
+#include "Summation.h"
+#include <immintrin.h>
+#include <intrin.h>
+
+static_assert(sizeof(Complex<double>) == 2*sizeof(double), "the kernels need the parts of a complex value next to each other");
+
+static bool checkVectorization()
+{
+	int registers[4];
+	__cpuid(registers, 0);
+
+	if (registers[0] < 7)
+		return false;
+
+	__cpuid(registers, 1);
+	auto fusedMultiplyAdd = (registers[2] & (1 << 12)) != 0;
+	auto operatingSystemSaves = (registers[2] & (1 << 27)) != 0;
+	auto advancedVectorExtensions = (registers[2] & (1 << 28)) != 0;
+
+	if (!fusedMultiplyAdd || !operatingSystemSaves || !advancedVectorExtensions)
+		return false;
+
+	// the operating system has to save the upper halfs of the registers during a context switch
+	if ((_xgetbv(0) & 6) != 6)
+		return false;
+
+	__cpuidex(registers, 7, 0);
+	return (registers[1] & (1 << 5)) != 0;
+}
+
+static inline double const* getParts(Complex<double> const *value)
+{
+	return reinterpret_cast<double const*>(value);
+}
+
+static inline double* getParts(Complex<double> *value)
+{
+	return reinterpret_cast<double*>(value);
+}
+
+static inline __m256d loadTwo(Complex<double> const *value)
+{
+	return _mm256_loadu_pd(getParts(value));
+}
+
+// the upper half is zero, which makes the last value of an odd count a neutral element of the sums
+static inline __m256d loadOne(Complex<double> const *value)
+{
+	return _mm256_insertf128_pd(_mm256_setzero_pd(), _mm_loadu_pd(getParts(value)), 0);
+}
+
+static inline __m256d loadTwo(Complex<double> const *first, Complex<double> const *second)
+{
+	return _mm256_insertf128_pd(_mm256_castpd128_pd256(_mm_loadu_pd(getParts(first))), _mm_loadu_pd(getParts(second)), 1);
+}
+
+// the products of the two complex values in x with the complex weight, whose parts are duplicated into all four elements
+static inline __m256d multiplyWithWeight(__m256d x, __m256d weightReal, __m256d weightImaginary)
+{
+	auto swapped = _mm256_permute_pd(x, 0x5);
+	return _mm256_fmaddsub_pd(x, weightReal, _mm256_mul_pd(swapped, weightImaginary));
+}
+
+static inline __m256d multiply(__m256d x, __m256d y)
+{
+	return multiplyWithWeight(x, _mm256_movedup_pd(y), _mm256_permute_pd(y, 0xF));
+}
+
+// the error free transformation of Knuth, the errors of all additions are collected in the compensation
+static inline void addCompensated(__m256d value, __m256d &sum, __m256d &compensation)
+{
+	auto nextSum = _mm256_add_pd(sum, value);
+	auto valueVirtual = _mm256_sub_pd(nextSum, sum);
+	auto sumVirtual = _mm256_sub_pd(nextSum, valueVirtual);
+	auto error = _mm256_add_pd(_mm256_sub_pd(sum, sumVirtual), _mm256_sub_pd(value, valueVirtual));
+	compensation = _mm256_add_pd(compensation, error);
+	sum = nextSum;
+}
+
+static inline double combineCompensated(double const *sums, double const *compensations, int first, int second)
+{
+	double error;
+	auto sum = twoSum(sums[first], sums[second], error);
+	return sum + (error + compensations[first] + compensations[second]);
+}
+
+// the check is done at the first call, as the kernels might be used during the initialization of other static variables
+bool areComplexDoubleKernelsVectorized()
+{
+	static const bool vectorized = checkVectorization();
+	return vectorized;
+}
+
+void calculateComplexProducts(Complex<double> const *x, Complex<double> const *y, int count, bool conjugateX, double *real, double *imaginary)
+{
+	auto i = 0;
+
+	if (areComplexDoubleKernelsVectorized())
+	{
+		auto conjugation = conjugateX ? _mm256_set_pd(-0.0, 0.0, -0.0, 0.0) : _mm256_setzero_pd();
+
+		for (; i + 4 <= count; i += 4)
+		{
+			auto first = multiply(_mm256_xor_pd(loadTwo(x + i), conjugation), loadTwo(y + i));
+			auto second = multiply(_mm256_xor_pd(loadTwo(x + i + 2), conjugation), loadTwo(y + i + 2));
+			// the unpacking results in the order 0, 2, 1, 3
+			_mm256_storeu_pd(real + i, _mm256_permute4x64_pd(_mm256_unpacklo_pd(first, second), 0xD8));
+			_mm256_storeu_pd(imaginary + i, _mm256_permute4x64_pd(_mm256_unpackhi_pd(first, second), 0xD8));
+		}
+	}
+
+	for (; i < count; ++i)
+	{
+		auto value = conjugateX ? std::conj(x[i])*y[i] : x[i]*y[i];
+		real[i] = value.real();
+		imaginary[i] = value.imag();
+	}
+}
+
+void calculateComplexWeightedSum(Complex<double> *result, Complex<double> const *x, Complex<double> const &yWeight, Complex<double> const *y, int count)
+{
+	auto i = 0;
+
+	if (areComplexDoubleKernelsVectorized())
+	{
+		auto weightReal = _mm256_set1_pd(yWeight.real());
+		auto weightImaginary = _mm256_set1_pd(yWeight.imag());
+
+		for (; i + 2 <= count; i += 2)
+		{
+			auto value = _mm256_add_pd(loadTwo(x + i), multiplyWithWeight(loadTwo(y + i), weightReal, weightImaginary));
+			_mm256_storeu_pd(getParts(result + i), value);
+		}
+	}
+
+	for (; i < count; ++i)
+		result[i] = x[i] + yWeight*y[i];
+}
+
+void addComplexWeightedSum(Complex<double> *result, Complex<double> const &xWeight, Complex<double> const *x, Complex<double> const &yWeight, Complex<double> const *y, int count)
+{
+	auto i = 0;
+
+	if (areComplexDoubleKernelsVectorized())
+	{
+		auto xWeightReal = _mm256_set1_pd(xWeight.real());
+		auto xWeightImaginary = _mm256_set1_pd(xWeight.imag());
+		auto yWeightReal = _mm256_set1_pd(yWeight.real());
+		auto yWeightImaginary = _mm256_set1_pd(yWeight.imag());
+
+		for (; i + 2 <= count; i += 2)
+		{
+			auto sum = _mm256_add_pd(multiplyWithWeight(loadTwo(x + i), xWeightReal, xWeightImaginary), multiplyWithWeight(loadTwo(y + i), yWeightReal, yWeightImaginary));
+			_mm256_storeu_pd(getParts(result + i), _mm256_add_pd(loadTwo(result + i), sum));
+		}
+	}
+
+	for (; i < count; ++i)
+		result[i] += xWeight*x[i] + yWeight*y[i];
+}
+
+void addComplexProducts(Complex<double> *result, Complex<double> const &factor, Complex<double> const *x, int xDistance, int count)
+{
+	auto i = 0;
+
+	if (areComplexDoubleKernelsVectorized())
+	{
+		auto factorReal = _mm256_set1_pd(factor.real());
+		auto factorImaginary = _mm256_set1_pd(factor.imag());
+
+		for (; i + 2 <= count; i += 2)
+		{
+			auto values = xDistance == 1 ? loadTwo(x + i) : loadTwo(x + i*xDistance, x + (i + 1)*xDistance);
+			_mm256_storeu_pd(getParts(result + i), _mm256_add_pd(loadTwo(result + i), multiplyWithWeight(values, factorReal, factorImaginary)));
+		}
+	}
+
+	for (; i < count; ++i)
+		result[i].addProduct(factor, x[i*xDistance]);
+}
+
+Complex<double> calculateComplexSparseProduct(Complex<double> const *values, int const *columns, int count, Complex<double> const *x)
+{
+	if (!areComplexDoubleKernelsVectorized())
+	{
+		SummationNeumaier<double> real;
+		SummationNeumaier<double> imaginary;
+		Complex<double> summand;
+
+		for (auto i = 0; i < count; ++i)
+		{
+			summand.assignProduct(values[i], x[columns[i]]);
+			real.add(summand.real());
+			imaginary.add(summand.imag());
+		}
+
+		return Complex<double>(real.getResult(), imaginary.getResult());
+	}
+
+	auto sum = _mm256_setzero_pd();
+	auto compensation = _mm256_setzero_pd();
+	auto i = 0;
+
+	for (; i + 2 <= count; i += 2)
+		addCompensated(multiply(loadTwo(values + i), loadTwo(x + columns[i], x + columns[i + 1])), sum, compensation);
+
+	if (i < count)
+		addCompensated(multiply(loadOne(values + i), loadOne(x + columns[i])), sum, compensation);
+
+	double sums[4];
+	double compensations[4];
+	_mm256_storeu_pd(sums, sum);
+	_mm256_storeu_pd(compensations, compensation);
+	return Complex<double>(combineCompensated(sums, compensations, 0, 2), combineCompensated(sums, compensations, 1, 3));
+}
+
+double calculateCompensatedSum(double const *values, int count)
+{
+	SummationNeumaier<double> summation;
+	auto i = 0;
+
+	if (areComplexDoubleKernelsVectorized())
+	{
+		auto sum = _mm256_setzero_pd();
+		auto compensation = _mm256_setzero_pd();
+
+		for (; i + 4 <= count; i += 4)
+			addCompensated(_mm256_loadu_pd(values + i), sum, compensation);
+
+		double sums[4];
+		double compensations[4];
+		_mm256_storeu_pd(sums, sum);
+		_mm256_storeu_pd(compensations, compensation);
+
+		for (auto lane = 0; lane < 4; ++lane)
+		{
+			summation.add(sums[lane]);
+			summation.add(compensations[lane]);
+		}
+	}
+
+	for (; i < count; ++i)
+		summation.add(values[i]);
+
+	return summation.getResult();
+}
\ No newline at end of file
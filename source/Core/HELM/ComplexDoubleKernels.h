@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Complex.h"
+
+// kernels for Complex<double>, which process two complex values with one AVX2 register and fused multiply adds, if the processor supports these,
+// and fall back to scalar loops otherwise; the real and imaginary part of a Complex<double> are adjacent doubles, therefore no reordering of the storage is necessary
+bool areComplexDoubleKernelsVectorized();
+// real[i] + imaginary[i]*j = x[i]*y[i], respectively conj(x[i])*y[i]
+void calculateComplexProducts(Complex<double> const *x, Complex<double> const *y, int count, bool conjugateX, double *real, double *imaginary);
+// result[i] = x[i] + yWeight*y[i]
+void calculateComplexWeightedSum(Complex<double> *result, Complex<double> const *x, Complex<double> const &yWeight, Complex<double> const *y, int count);
+// result[i] += xWeight*x[i] + yWeight*y[i]
+void addComplexWeightedSum(Complex<double> *result, Complex<double> const &xWeight, Complex<double> const *x, Complex<double> const &yWeight, Complex<double> const *y, int count);
+// result[i] += factor*x[i*xDistance]
+void addComplexProducts(Complex<double> *result, Complex<double> const &factor, Complex<double> const *x, int xDistance, int count);
+// sum of values[i]*x[columns[i]], the partial sums are compensated like the summation of Neumaier
+Complex<double> calculateComplexSparseProduct(Complex<double> const *values, int const *columns, int count, Complex<double> const *x);
+// sum of values[i], compensated like the summation of Neumaier
+double calculateCompensatedSum(double const *values, int count);
\ No newline at end of file
@@ -0,0 +1,209 @@
+#include "DoubleDouble.h"
+#include "ErrorFreeTransformations.h"
+#include "ExtendedPrecisionOutput.h"
+#include <cmath>
+
+DoubleDouble::DoubleDouble() :
+	_high(0),
+	_low(0)
+{ }
+
+DoubleDouble::DoubleDouble(DoubleDouble const& rhs) :
+	_high(rhs.getHigh()),
+	_low(rhs.getLow())
+{ }
+
+DoubleDouble::DoubleDouble(double high, double low)
+{
+	_high = quickTwoSum(high, low, _low);
+}
+
+DoubleDouble::DoubleDouble(float value) :
+	_high(value),
+	_low(0)
+{ }
+
+DoubleDouble::DoubleDouble(double value) :
+	_high(value),
+	_low(0)
+{ }
+
+DoubleDouble::DoubleDouble(long double value) :
+	_high(static_cast<double>(value)),
+	_low(static_cast<double>(value - static_cast<long double>(static_cast<double>(value))))
+{ }
+
+DoubleDouble::DoubleDouble(int value) :
+	_high(value),
+	_low(0)
+{ }
+
+DoubleDouble::operator double() const
+{
+	return _high + _low;
+}
+
+DoubleDouble::operator long double() const
+{
+	return static_cast<long double>(_high) + static_cast<long double>(_low);
+}
+
+DoubleDouble::operator int() const
+{
+	return static_cast<int>(_high + _low);
+}
+
+DoubleDouble& DoubleDouble::operator=(const DoubleDouble &rhs)
+{
+	_high = rhs.getHigh();
+	_low = rhs.getLow();
+	return *this;
+}
+
+DoubleDouble& DoubleDouble::operator+=(const DoubleDouble &rhs)
+{
+	*this = *this + rhs;
+	return *this;
+}
+
+DoubleDouble& DoubleDouble::operator-=(const DoubleDouble &rhs)
+{
+	*this = *this - rhs;
+	return *this;
+}
+
+DoubleDouble& DoubleDouble::operator*=(const DoubleDouble &rhs)
+{
+	*this = *this * rhs;
+	return *this;
+}
+
+DoubleDouble& DoubleDouble::operator/=(const DoubleDouble &rhs)
+{
+	*this = *this / rhs;
+	return *this;
+}
+
+double DoubleDouble::getHigh() const
+{
+	return _high;
+}
+
+double DoubleDouble::getLow() const
+{
+	return _low;
+}
+
+const DoubleDouble DoubleDouble::operator+() const
+{
+	return *this;
+}
+
+const DoubleDouble DoubleDouble::operator-() const
+{
+	return DoubleDouble(-_high, -_low);
+}
+
+const DoubleDouble operator+(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	double highError, lowError;
+	auto high = twoSum(lhs.getHigh(), rhs.getHigh(), highError);
+	auto low = twoSum(lhs.getLow(), rhs.getLow(), lowError);
+	highError += low;
+	high = quickTwoSum(high, highError, highError);
+	highError += lowError;
+	return DoubleDouble(high, highError);
+}
+
+const DoubleDouble operator-(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return lhs + (-rhs);
+}
+
+const DoubleDouble operator*(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	double error;
+	auto product = twoProduct(lhs.getHigh(), rhs.getHigh(), error);
+	error += lhs.getHigh()*rhs.getLow() + lhs.getLow()*rhs.getHigh();
+	return DoubleDouble(product, error);
+}
+
+// long division with three partial quotients, each of them calculated with double precision
+const DoubleDouble operator/(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	auto firstQuotient = lhs.getHigh()/rhs.getHigh();
+	auto remainder = lhs - rhs*DoubleDouble(firstQuotient);
+	auto secondQuotient = remainder.getHigh()/rhs.getHigh();
+	remainder -= rhs*DoubleDouble(secondQuotient);
+	auto thirdQuotient = remainder.getHigh()/rhs.getHigh();
+	return DoubleDouble(firstQuotient, secondQuotient) + DoubleDouble(thirdQuotient);
+}
+
+bool operator<(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return lhs.getHigh() < rhs.getHigh() || (lhs.getHigh() == rhs.getHigh() && lhs.getLow() < rhs.getLow());
+}
+
+bool operator>(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return rhs < lhs;
+}
+
+bool operator>=(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return !(lhs < rhs);
+}
+
+bool operator<=(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return !(rhs < lhs);
+}
+
+bool operator==(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return lhs.getHigh() == rhs.getHigh() && lhs.getLow() == rhs.getLow();
+}
+
+bool operator!=(const DoubleDouble &lhs, const DoubleDouble &rhs)
+{
+	return !(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream &stream, DoubleDouble const& value)
+{
+	return writeExtendedPrecision(stream, value, value.getHigh(), 31);
+}
+
+DoubleDouble std::abs(DoubleDouble const& value)
+{
+	return value.getHigh() < 0 ? -value : value;
+}
+
+// one Newton step on top of the square root of the leading component doubles the number of correct digits
+DoubleDouble std::sqrt(DoubleDouble const& value)
+{
+	if (value.getHigh() <= 0)
+		return DoubleDouble(sqrt(value.getHigh()));
+
+	auto inverseRoot = 1.0/sqrt(value.getHigh());
+	auto root = value.getHigh()*inverseRoot;
+	auto correction = (value - DoubleDouble(root)*DoubleDouble(root)).getHigh()*inverseRoot*0.5;
+	double error;
+	auto sum = twoSum(root, correction, error);
+	return DoubleDouble(sum, error);
+}
+
+DoubleDouble std::log(DoubleDouble const& value)
+{
+	return DoubleDouble(log(static_cast<double>(value)));
+}
+
+DoubleDouble std::ceil(DoubleDouble const& value)
+{
+	auto high = ceil(value.getHigh());
+
+	if (high != value.getHigh())
+		return DoubleDouble(high);
+
+	return DoubleDouble(high, ceil(value.getLow()));
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <ostream>
+
+// unevaluated sum of two doubles, which gives about 106 bits of mantissa with hardware floating point operations only
+class DoubleDouble
+{
+public:
+	DoubleDouble();
+	DoubleDouble(DoubleDouble const& rhs);
+	DoubleDouble(double high, double low);
+	explicit DoubleDouble(float value);
+	explicit DoubleDouble(double value);
+	explicit DoubleDouble(long double value);
+	explicit DoubleDouble(int value);
+
+	operator double() const;
+	operator long double() const;
+	operator int() const;
+	DoubleDouble& operator=(const DoubleDouble &rhs);
+	DoubleDouble& operator+=(const DoubleDouble &rhs);
+	DoubleDouble& operator-=(const DoubleDouble &rhs);
+	DoubleDouble& operator*=(const DoubleDouble &rhs);
+	DoubleDouble& operator/=(const DoubleDouble &rhs);
+	double getHigh() const;
+	double getLow() const;
+	const DoubleDouble operator+() const;
+	const DoubleDouble operator-() const;
+
+private:
+	double _high;
+	double _low;
+};
+
+const DoubleDouble operator+(const DoubleDouble &lhs, const DoubleDouble &rhs);
+const DoubleDouble operator-(const DoubleDouble &lhs, const DoubleDouble &rhs);
+const DoubleDouble operator*(const DoubleDouble &lhs, const DoubleDouble &rhs);
+const DoubleDouble operator/(const DoubleDouble &lhs, const DoubleDouble &rhs);
+bool operator<(const DoubleDouble &lhs, const DoubleDouble &rhs);
+bool operator>(const DoubleDouble &lhs, const DoubleDouble &rhs);
+bool operator>=(const DoubleDouble &lhs, const DoubleDouble &rhs);
+bool operator<=(const DoubleDouble &lhs, const DoubleDouble &rhs);
+bool operator==(const DoubleDouble &lhs, const DoubleDouble &rhs);
+bool operator!=(const DoubleDouble &lhs, const DoubleDouble &rhs);
+std::ostream& operator<<(std::ostream &stream, DoubleDouble const& value);
+
+namespace std
+{
+	DoubleDouble abs(DoubleDouble const& value);
+	DoubleDouble sqrt(DoubleDouble const& value);
+	// only as accurate as the logarithm of a double, like the one of MultiPrecision
+	DoubleDouble log(DoubleDouble const& value);
+	DoubleDouble ceil(DoubleDouble const& value);
+}
\ No newline at end of file
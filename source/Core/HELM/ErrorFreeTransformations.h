@@ -0,0 +1,46 @@
+#pragma once
+
+// building blocks of DoubleDouble and QuadDouble, which calculate the rounding error of a floating point operation exactly,
+// therefore the compiler must not contract a*b + c into a fused multiply add
+
+inline double quickTwoSum(double a, double b, double &error)
+{
+	double sum = a + b;
+	error = b - (sum - a);
+	return sum;
+}
+
+inline double twoSum(double a, double b, double &error)
+{
+	double sum = a + b;
+	double bVirtual = sum - a;
+	error = (a - (sum - bVirtual)) + (b - bVirtual);
+	return sum;
+}
+
+inline void split(double a, double &high, double &low)
+{
+	// 2^27 + 1
+	const double splitter = 134217729.0;
+	double temp = splitter*a;
+	high = temp - (temp - a);
+	low = a - high;
+}
+
+inline double twoProduct(double a, double b, double &error)
+{
+	double product = a*b;
+	double aHigh, aLow, bHigh, bLow;
+	split(a, aHigh, aLow);
+	split(b, bHigh, bLow);
+	error = ((aHigh*bHigh - product) + aHigh*bLow + aLow*bHigh) + aLow*bLow;
+	return product;
+}
+
+inline void threeSum(double &a, double &b, double &c)
+{
+	double t1, t2, t3;
+	t1 = twoSum(a, b, t2);
+	a = twoSum(c, t1, t3);
+	b = twoSum(t2, t3, c);
+}
\ No newline at end of file
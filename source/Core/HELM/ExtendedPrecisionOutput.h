@@ -0,0 +1,56 @@
+#pragma once
+
+#include <ostream>
+#include <sstream>
+#include <cmath>
+#include <limits>
+
+// writes the value in scientific notation, because printing the components one after another would be misleading
+template<class Floating>
+std::ostream& writeExtendedPrecision(std::ostream &stream, Floating const &value, double leadingComponent, int digitCount)
+{
+	if (leadingComponent == 0 || !(std::abs(leadingComponent) <= std::numeric_limits<double>::max()))
+		return stream << leadingComponent;
+
+	Floating const ten(10);
+	Floating const one(1);
+	auto remainder = std::abs(value);
+	auto exponent = static_cast<int>(std::floor(std::log10(std::abs(leadingComponent))));
+	std::ostringstream digits;
+
+	for (auto i = 0; i < exponent; ++i)
+		remainder /= ten;
+
+	for (auto i = 0; i > exponent; --i)
+		remainder *= ten;
+
+	if (remainder >= ten)
+	{
+		remainder /= ten;
+		++exponent;
+	}
+
+	if (remainder < one)
+	{
+		remainder *= ten;
+		--exponent;
+	}
+
+	for (auto i = 0; i < digitCount; ++i)
+	{
+		auto digit = static_cast<int>(std::ceil(remainder));
+
+		if (Floating(digit) > remainder)
+			--digit;
+
+		digit = digit < 0 ? 0 : (digit > 9 ? 9 : digit);
+		digits << digit;
+
+		if (i == 0)
+			digits << ".";
+
+		remainder = (remainder - Floating(digit))*ten;
+	}
+
+	return stream << (leadingComponent < 0 ? "-" : "") << digits.str() << "e" << exponent;
+}
\ No newline at end of file
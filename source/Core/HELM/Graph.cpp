@@ -54,6 +54,53 @@ std::vector<int> Graph::calculateReverseCuthillMcKee(int startNodeIndex) const
 	return calculateReverseCuthillMcKee(nodes);
 }
 
+std::vector<int> Graph::calculateMinimumDegreeOrdering() const
+{
+	const int nodeCount = _nodes.size();
+	std::map<const Node*, int> positions;
+	std::vector<std::set<int>> adjacency(nodeCount);
+	std::set<std::pair<int, int>> nodesByDegree;
+	std::vector<int> result;
+	result.reserve(nodeCount);
+
+	for (auto i = 0; i < nodeCount; ++i)
+		positions[_nodes[i]] = i;
+
+	for (auto i = 0; i < nodeCount; ++i)
+		for (auto neighbour : _nodes[i]->getNeighbours())
+			if (neighbour != _nodes[i])
+				adjacency[i].insert(positions[neighbour]);
+
+	for (auto i = 0; i < nodeCount; ++i)
+		nodesByDegree.insert(std::pair<int, int>(adjacency[i].size(), i));
+
+	// eliminating a node connects all its neighbours, which is exactly the fill-in it causes
+	while (!nodesByDegree.empty())
+	{
+		auto node = nodesByDegree.begin()->second;
+		nodesByDegree.erase(nodesByDegree.begin());
+		result.push_back(_nodes[node]->getIndex());
+		std::set<int> neighbours;
+		neighbours.swap(adjacency[node]);
+
+		for (auto neighbour : neighbours)
+		{
+			nodesByDegree.erase(std::pair<int, int>(adjacency[neighbour].size(), neighbour));
+			adjacency[neighbour].erase(node);
+		}
+
+		for (auto one : neighbours)
+			for (auto two : neighbours)
+				if (one != two)
+					adjacency[one].insert(two);
+
+		for (auto neighbour : neighbours)
+			nodesByDegree.insert(std::pair<int, int>(adjacency[neighbour].size(), neighbour));
+	}
+
+	return result;
+}
+
 std::vector<std::vector<int>> Graph::createLayeringFrom(int startNode) const
 {
 	auto layering = createLayeringFrom(_nodesByIndex.at(startNode));	
@@ -18,6 +18,7 @@ public:
 	void connect(int one, int two);
 	std::vector<int> calculateReverseCuthillMcKee() const;
 	std::vector<int> calculateReverseCuthillMcKee(int startNode) const;
+	std::vector<int> calculateMinimumDegreeOrdering() const;
 	std::vector<std::vector<int>> createLayeringFrom(int startNode) const;
 	int findPseudoPeriphereNode() const;
 	int findPseudoPeriphereNode(size_t &eccentricity) const;
@@ -0,0 +1,47 @@
+#include "HeapAllocationCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<bool> allocationCounting(false);
+static std::atomic<long long> allocationCount(0);
+
+// allocations of other threads are counted as well
+void HeapAllocationCounter::start()
+{
+	allocationCount = 0;
+	allocationCounting = true;
+}
+
+void HeapAllocationCounter::stop()
+{
+	allocationCounting = false;
+}
+
+long long HeapAllocationCounter::getCount()
+{
+	return allocationCount;
+}
+
+void HeapAllocationCounter::count()
+{
+	if (allocationCounting)
+		++allocationCount;
+}
+
+// the array and nothrow variants of the standard library forward to these two
+void* operator new(size_t size)
+{
+	HeapAllocationCounter::count();
+	auto result = malloc(size == 0 ? 1 : size);
+
+	if (result == 0)
+		throw std::bad_alloc();
+
+	return result;
+}
+
+void operator delete(void *pointer) noexcept
+{
+	free(pointer);
+}
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+// counts every allocation with the global operator new of this library, independent of the type which allocates,
+// the memory functions of MPIR are not covered by this and are counted by MultiPrecision itself
+class HeapAllocationCounter
+{
+public:
+	static void start();
+	static void stop();
+	static long long getCount();
+	static void count();
+};
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Complex.h"
+
+template<typename Floating, typename ComplexFloating>
+class IAnalyticContinuation
+{
+public:
+	virtual ~IAnalyticContinuation() { }
+
+	virtual void updateWithLastCoefficients() = 0;
+	virtual void updateWithCoefficients(int coefficientCount) = 0;
+	virtual Complex<long double> getResult() const = 0;
+};
\ No newline at end of file
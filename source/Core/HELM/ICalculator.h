@@ -1,6 +1,10 @@
 #pragma once
 
 #include "ConsoleOutput.h"
+#include "ProgressCallback.h"
+#include "CancellationToken.h"
+#include "AnalyticContinuationMethod.h"
+#include "BiCGSTABPreconditioner.h"
 #include "Complex.h"
 
 class ICalculator
@@ -13,14 +17,38 @@ public:
 	virtual void setPQBus(int busId, int node, Complex<long double> power) = 0;
 	virtual void setPVBus(int busId, int node, double powerReal, double voltageMagnitude) = 0;
 	virtual void setConstantCurrent(int node, Complex<long double> value) = 0;
+	virtual void setAdmittances(int count, int const *rows, int const *columns, double const *real, double const *imaginary) = 0;
+	virtual void setAdmittancesCompressed(int const *rowPointers, int const *columns, double const *real, double const *imaginary) = 0;
+	virtual void setAdmittanceRowSums(double const *real, double const *imaginary) = 0;
+	virtual void setPQBuses(int const *nodes, double const *powerReal, double const *powerImaginary) = 0;
+	virtual void setPVBuses(int const *nodes, double const *powerReal, double const *voltageMagnitude) = 0;
+	virtual void setConstantCurrents(double const *real, double const *imaginary) = 0;
+	virtual void setPQBusesOfScenario(int scenario, int const *nodes, double const *powerReal, double const *powerImaginary) = 0;
+	virtual void setPVBusesOfScenario(int scenario, int const *nodes, double const *powerReal, double const *voltageMagnitude) = 0;
+	virtual void setContinuationInterval(int stepCount) = 0;
+	virtual void setSentinelNodes(int count, int const *nodes) = 0;
+	virtual void setAnalyticContinuationMethod(AnalyticContinuationMethod method) = 0;
+	virtual void setBiCGSTABPreconditioner(BiCGSTABPreconditioner preconditioner) = 0;
+	virtual void setSolutionHistoryLength(int length) = 0;
+	virtual void setIterativeSolverTolerance(double tolerance) = 0;
 	virtual void calculate() = 0;
+	virtual bool calculate(CancellationToken const &cancellationToken) = 0;
+	virtual void setProgressCallback(ProgressCallback callback, int calculatorId) = 0;
 	virtual double getVoltageReal(int node) const = 0;
 	virtual double getVoltageImaginary(int node) const = 0;
 	virtual double getCoefficientReal(int step, int node) const = 0;
 	virtual double getCoefficientImaginary(int step, int node) const = 0;
 	virtual double getInverseCoefficientReal(int step, int node) const = 0;
 	virtual double getInverseCoefficientImaginary(int step, int node) const = 0;
+	virtual void getVoltages(double *real, double *imaginary) const = 0;
+	virtual void getVoltagesOfScenario(int scenario, double *real, double *imaginary) const = 0;
+	virtual void getCoefficients(int step, double *real, double *imaginary) const = 0;
+	virtual void getInverseCoefficients(int step, double *real, double *imaginary) const = 0;
+	virtual int getErrorHistoryCount() = 0;
+	virtual void getErrorHistory(double *errors) = 0;
+	virtual int getCoefficientCount() const = 0;
 	virtual int getNodeCount() const = 0;
+	virtual int getScenarioCount() const = 0;
 	virtual double getProgress() = 0;
 	virtual double getRelativePowerError() = 0;
 	virtual int getMaximumPossibleCoefficientCount() = 0;
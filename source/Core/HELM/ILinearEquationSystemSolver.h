@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Vector.h"
+#include "SolutionHistory.h"
+#include <vector>
 
 template<class Floating, class ComplexFloating>
 class ILinearEquationSystemSolver
@@ -9,4 +11,37 @@ public:
 	virtual ~ILinearEquationSystemSolver() { }
 
 	virtual Vector<Floating, ComplexFloating> solve(const Vector<Floating, ComplexFloating> &b) const = 0;
+
+	// overwrites x with the solution, the solvers reuse their workspaces for this, therefore a solver must not be used by several threads at once
+	virtual void solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const = 0;
+
+	// iterative solvers should override this to make use of the previous solutions of the same system, a direct solver does not need them
+	virtual Vector<Floating, ComplexFloating> solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &) const
+	{
+		return solve(b);
+	}
+
+	virtual void solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &, Vector<Floating, ComplexFloating> &x) const
+	{
+		solve(b, x);
+	}
+
+	// solvers which can share work between several right hand sides should override this
+	virtual std::vector<Vector<Floating, ComplexFloating>> solveMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b) const
+	{
+		std::vector<Vector<Floating, ComplexFloating>> x;
+		x.reserve(b.size());
+
+		for (auto &rightHandSide : b)
+			x.push_back(solve(rightHandSide));
+
+		return x;
+	}
+
+	// x has to contain one vector for each right hand side
+	virtual void solveMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &x) const
+	{
+		for (size_t i = 0; i < b.size(); ++i)
+			solve(b[i], x[i]);
+	}
 };
\ No newline at end of file
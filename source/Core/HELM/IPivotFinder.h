@@ -1,6 +1,7 @@
 #pragma once
 
 #include "SparseMatrix.h"
+#include <vector>
 
 template<class Floating, class ComplexFloating>
 class IPivotFinder
@@ -8,5 +9,7 @@ class IPivotFinder
 public:
 	virtual ~IPivotFinder() { }
 
-	virtual int operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row) const = 0;
+	// candidateRows is the set of rows which are not yet assigned to a pivot and have an element in the column row,
+	// implementations must not rely on their order, and the element of a candidate can still be zero after a cancellation
+	virtual int operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row, std::vector<int> const &candidateRows) const = 0;
 };
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Vector.h"
+
+template<class Floating, class ComplexFloating>
+class IPreconditioner
+{
+public:
+	virtual ~IPreconditioner() { }
+
+	// calculates an approximation of the system matrix inverse applied to the source
+	virtual void apply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const = 0;
+};
\ No newline at end of file
@@ -1,45 +1,92 @@
 #include "LUDecomposition.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include "NumericalTraits.h"
+#include <vector>
+#include <algorithm>
+#include <numeric>
 #include <assert.h>
+#include <omp.h>
 
 template class LUDecomposition<long double, Complex<long double>>;
 template class LUDecomposition<MultiPrecision, Complex<MultiPrecision>>;
+template class LUDecomposition<DoubleDouble, Complex<DoubleDouble>>;
+template class LUDecomposition<QuadDouble, Complex<QuadDouble>>;
+template class LUDecomposition<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
-LUDecomposition<Floating, ComplexFloating>::LUDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, IPivotFinder<Floating, ComplexFloating> *pivotFinder) :
+LUDecomposition<Floating, ComplexFloating>::LUDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionOrdering ordering, IPivotFinder<Floating, ComplexFloating> *pivotFinder) :
 	_dimension(systemMatrix.getRowCount()),
+	_ordering(ordering),
 	_left(_dimension, _dimension),
 	_upper(_dimension, _dimension),
-	_permutation(_dimension, _dimension),
-	_permutationBandwidthReduction(_dimension, _dimension),
-	_permutationBandwidthReductionInverse(_dimension, _dimension),
-	_pivotFinder(pivotFinder)
+	_pivotFinder(pivotFinder),
+	_symbolic(0),
+	_bPermutated(_dimension),
+	_xPermutated(_dimension),
+	_xImproved(_dimension),
+	_improvement(_dimension),
+	_residual(_dimension),
+	_y(_dimension),
+	_upperProduct(_dimension),
+	_leftProduct(_dimension)
 {
 	assert(systemMatrix.getRowCount() == systemMatrix.getColumnCount());
 	assert(pivotFinder != 0);
 	calculateDecomposition(systemMatrix);
 }
 
+template<class Floating, class ComplexFloating>
+LUDecomposition<Floating, ComplexFloating>::LUDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionSymbolic const &symbolic, IPivotFinder<Floating, ComplexFloating> *pivotFinder) :
+	_dimension(systemMatrix.getRowCount()),
+	_ordering(symbolic.getOrderingMethod()),
+	_left(_dimension, _dimension),
+	_upper(_dimension, _dimension),
+	_pivotFinder(pivotFinder),
+	_symbolic(new LUDecompositionSymbolic(symbolic)),
+	_bPermutated(_dimension),
+	_xPermutated(_dimension),
+	_xImproved(_dimension),
+	_improvement(_dimension),
+	_residual(_dimension),
+	_y(_dimension),
+	_upperProduct(_dimension),
+	_leftProduct(_dimension)
+{
+	assert(systemMatrix.getRowCount() == systemMatrix.getColumnCount());
+	assert(pivotFinder != 0);
+	refactorize(systemMatrix);
+}
+
 template<class Floating, class ComplexFloating>
 LUDecomposition<Floating, ComplexFloating>::~LUDecomposition()
 {
 	delete _pivotFinder;
 	_pivotFinder = 0;
+	delete _symbolic;
+	_symbolic = 0;
 }
 
 template<class Floating, class ComplexFloating>
 Vector<Floating, ComplexFloating> LUDecomposition<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b) const
+{
+	Vector<Floating, ComplexFloating> x(_dimension);
+	solve(b, x);
+	return x;
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const
 {
 	assert(_dimension == b.getCount());
-	Vector<Floating, ComplexFloating> bPermutated(_dimension);
-	Vector<Floating, ComplexFloating> xPermutated(_dimension);
-	Vector<Floating, ComplexFloating> residual(_dimension);
-	Vector<Floating, ComplexFloating> xImproved(_dimension);
-	_permutationBandwidthReduction.multiply(bPermutated, b);
-	auto bSquaredNorm = bPermutated.squaredNorm();
-	auto x = solveInternal(bPermutated);
-	auto lastError = calculateError(x, bPermutated, bSquaredNorm, residual);
+	assert(_dimension == x.getCount());
+	_bPermutated.permutate(b, _permutationBandwidthReduction);
+	auto bSquaredNorm = _bPermutated.squaredNorm();
+	solveInternal(_bPermutated, _xPermutated);
+	auto lastError = calculateError(_xPermutated, _bPermutated, bSquaredNorm, _residual);
 	auto improved = true;
 	auto maximumIterations = 10;
 	auto iteration = 0;
@@ -47,13 +94,13 @@ Vector<Floating, ComplexFloating> LUDecomposition<Floating, ComplexFloating>::so
 	// iterative refinement
 	while(improved && iteration < maximumIterations)
 	{
-		auto improvement = solveInternal(residual);
-		xImproved.add(x, improvement);
-		auto error = calculateError(xImproved, bPermutated, bSquaredNorm, residual);
+		solveInternal(_residual, _improvement);
+		_xImproved.add(_xPermutated, _improvement);
+		auto error = calculateError(_xImproved, _bPermutated, bSquaredNorm, _residual);
 
 		if (error < lastError)
 		{
-			x = xImproved;
+			_xPermutated = _xImproved;
 			lastError = error;
 		}
 		else
@@ -62,25 +109,162 @@ Vector<Floating, ComplexFloating> LUDecomposition<Floating, ComplexFloating>::so
 		++iteration;
 	}
 
-	_permutationBandwidthReductionInverse.multiply(xPermutated, x);
-	return xPermutated;
+	x.permutateInverse(_xPermutated, _permutationBandwidthReduction);
+}
+
+template<class Floating, class ComplexFloating>
+std::vector<Vector<Floating, ComplexFloating>> LUDecomposition<Floating, ComplexFloating>::solveMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b) const
+{
+	std::vector<Vector<Floating, ComplexFloating>> x(b.size(), Vector<Floating, ComplexFloating>(_dimension));
+	solveMultiple(b, x);
+	return x;
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::solveMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &x) const
+{
+	auto count = b.size();
+	auto &bSquaredNorms = _bSquaredNormsMultiple;
+	auto &lastErrors = _lastErrorsMultiple;
+	auto &active = _activeMultiple;
+	auto &stillImproving = _stillImprovingMultiple;
+	assert(x.size() == count);
+	reserveWorkspacesMultiple(count);
+	active.resize(count);
+	std::iota(active.begin(), active.end(), 0);
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		assert(_dimension == b[i].getCount());
+		_bPermutatedMultiple[i].permutate(b[i], _permutationBandwidthReduction);
+		bSquaredNorms[i] = _bPermutatedMultiple[i].squaredNorm();
+	}
+
+	solveInternalMultiple(_bPermutatedMultiple, _xPermutatedMultiple, active);
+
+	for (size_t i = 0; i < count; ++i)
+		lastErrors[i] = calculateError(_xPermutatedMultiple[i], _bPermutatedMultiple[i], bSquaredNorms[i], _residualsMultiple[i]);
+
+	auto maximumIterations = 10;
+	auto iteration = 0;
+
+	// iterative refinement, which is only continued for the right hand sides which still improve
+	while(!active.empty() && iteration < maximumIterations)
+	{
+		stillImproving.clear();
+		solveInternalMultiple(_residualsMultiple, _improvementsMultiple, active);
+
+		for (auto i : active)
+		{
+			_xImproved.add(_xPermutatedMultiple[i], _improvementsMultiple[i]);
+			auto error = calculateError(_xImproved, _bPermutatedMultiple[i], bSquaredNorms[i], _residualsMultiple[i]);
+
+			if (error < lastErrors[i])
+			{
+				_xPermutatedMultiple[i] = _xImproved;
+				lastErrors[i] = error;
+				stillImproving.push_back(i);
+			}
+		}
+
+		active.swap(stillImproving);
+		++iteration;
+	}
+
+	for (size_t i = 0; i < count; ++i)
+		x[i].permutateInverse(_xPermutatedMultiple[i], _permutationBandwidthReduction);
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::refactorize(SparseMatrix<Floating, ComplexFloating> const &systemMatrix)
+{
+	if (!calculateNumericDecomposition(systemMatrix))
+		calculateDecomposition(systemMatrix);
+}
+
+template<class Floating, class ComplexFloating>
+LUDecompositionSymbolic const& LUDecomposition<Floating, ComplexFloating>::getSymbolic() const
+{
+	return *_symbolic;
+}
+
+template<class Floating, class ComplexFloating>
+int LUDecomposition<Floating, ComplexFloating>::getNonZeroCount() const
+{
+	return _left.getNonZeroCount() + _upper.getNonZeroCount();
+}
+
+template<class Floating, class ComplexFloating>
+int LUDecomposition<Floating, ComplexFloating>::getForwardLevelCount() const
+{
+	return _forwardLevels.getLevelCount();
+}
+
+template<class Floating, class ComplexFloating>
+int LUDecomposition<Floating, ComplexFloating>::getBackwardLevelCount() const
+{
+	return _backwardLevels.getLevelCount();
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::solveInternal(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const
+{
+	forwardSubstitution(b, _y);
+	backwardSubstitution(_y, x);
+}
+
+// the workspaces only grow, therefore the same number of right hand sides does not allocate again
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::reserveWorkspacesMultiple(size_t count) const
+{
+	while (_bPermutatedMultiple.size() < count)
+	{
+		_bPermutatedMultiple.push_back(Vector<Floating, ComplexFloating>(_dimension));
+		_xPermutatedMultiple.push_back(Vector<Floating, ComplexFloating>(_dimension));
+		_improvementsMultiple.push_back(Vector<Floating, ComplexFloating>(_dimension));
+		_residualsMultiple.push_back(Vector<Floating, ComplexFloating>(_dimension));
+		_yMultiple.push_back(Vector<Floating, ComplexFloating>(_dimension));
+	}
+
+	// the indices of the active right hand sides are swapped between both buffers, therefore both need the full capacity
+	_bSquaredNormsMultiple.resize(_bPermutatedMultiple.size());
+	_lastErrorsMultiple.resize(_bPermutatedMultiple.size());
+	_activeMultiple.reserve(count);
+	_stillImprovingMultiple.reserve(count);
+
+	// every thread of the substitutions sums up in its own buffers
+	size_t threadCount = std::max(omp_get_max_threads(), omp_get_num_procs());
+
+	if (_summandsRealMultiple.size() < threadCount)
+	{
+		_summandsRealMultiple.resize(threadCount);
+		_summandsImaginaryMultiple.resize(threadCount);
+	}
+
+	for (size_t i = 0; i < _summandsRealMultiple.size(); ++i)
+	{
+		if (_summandsRealMultiple[i].size() >= count)
+			continue;
+
+		_summandsRealMultiple[i].resize(count);
+		_summandsImaginaryMultiple[i].resize(count);
+	}
 }
 
+// only the right hand sides at the given indices are solved
 template<class Floating, class ComplexFloating>
-Vector<Floating, ComplexFloating> LUDecomposition<Floating, ComplexFloating>::solveInternal(const Vector<Floating, ComplexFloating> &b) const
+void LUDecomposition<Floating, ComplexFloating>::solveInternalMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &x, std::vector<size_t> const &indices) const
 {
-	auto y = forwardSubstitution(b);
-	return backwardSubstitution(y);
+	forwardSubstitutionMultiple(b, _yMultiple, indices);
+	backwardSubstitutionMultiple(_yMultiple, x, indices);
 }
 
 template<class Floating, class ComplexFloating>
 Floating LUDecomposition<Floating, ComplexFloating>::calculateError(const Vector<Floating, ComplexFloating> &x, const Vector<Floating, ComplexFloating> &b, ComplexFloating const &bSquaredNorm, Vector<Floating, ComplexFloating> &residual) const
 {
-	Vector<Floating, ComplexFloating> tempOne(_dimension);
-	Vector<Floating, ComplexFloating> tempTwo(_dimension);
-	_upper.multiply(tempOne, x);
-	_left.multiply(tempTwo, tempOne);
-	residual.subtract(b, tempTwo);
+	_upper.multiply(_upperProduct, x);
+	_left.multiply(_leftProduct, _upperProduct);
+	residual.subtract(b, _leftProduct);
 	auto residualSquaredNorm = residual.squaredNorm();
 	return std::sqrt(std::abs(residualSquaredNorm/bSquaredNorm));
 }
@@ -89,32 +273,78 @@ template<class Floating, class ComplexFloating>
 void LUDecomposition<Floating, ComplexFloating>::calculateDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix)
 {
 	_upper = systemMatrix;
-	auto permutationOrder = _upper.reduceBandwidth();
-	auto permutationOrderInverted = SparseMatrix<Floating, ComplexFloating>::invertPermutation(permutationOrder);
-	_permutationBandwidthReduction = SparseMatrix<Floating, ComplexFloating>(permutationOrder);
-	_permutationBandwidthReductionInverse = SparseMatrix<Floating, ComplexFloating>(permutationOrderInverted);
+	_upper.unfreeze();
+	_left = SparseMatrix<Floating, ComplexFloating>(_dimension, _dimension);
+	auto permutationOrder = _ordering == LUDecompositionOrderingMinimumDegree ? _upper.reduceFillIn() : _upper.reduceBandwidth();
+	std::vector<int> pivotOrder(_dimension);
+	std::vector<int> rowIds(_dimension);
+	std::vector<int> rowPositions(_dimension);
+	std::vector<std::vector<int>> rowIdsOfColumns(_dimension);
+	std::vector<int> candidateRowIds;
+	std::vector<int> candidateRows;
 	auto one = ComplexFloating(Floating(1));
 	auto zero = ComplexFloating(Floating(0));
 
 	for (auto i = 0; i < _dimension; ++i)
-		_permutation.set(i, i, one);
+	{
+		pivotOrder[i] = i;
+		rowIds[i] = i;
+		rowPositions[i] = i;
+	}
+
+	// the rows are referenced by ids which stay the same during the row swaps, so that the
+	// column structure only has to be extended by the fill-in, finished rows are skipped
+	for (auto row = 0; row < _dimension; ++row)
+		for (auto iterator = _upper.getRowIterator(row); iterator.isValid(); iterator.next())
+			rowIdsOfColumns[iterator.getColumn()].push_back(row);
 
 	for (auto i = 0; i < _dimension - 1; ++i)
 	{
-		auto pivotIndex = (*_pivotFinder)(_upper, i);
+		candidateRowIds.clear();
+		candidateRows.clear();
+
+		for (auto id : rowIdsOfColumns[i])
+			if (rowPositions[id] >= i)
+			{
+				candidateRowIds.push_back(id);
+				candidateRows.push_back(rowPositions[id]);
+			}
+
+		// only makes the choice between equally good pivots reproducible, the order is not part of the interface of the pivot finders
+		std::sort(candidateRows.begin(), candidateRows.end());
+		auto pivotIndex = (*_pivotFinder)(_upper, i, candidateRows);
 		auto pivotElement = _upper(pivotIndex, i);
 		_upper.swapRows(i, pivotIndex);
 		_left.swapRows(i, pivotIndex);
-		_permutation.swapRows(i, pivotIndex);
+		std::swap(pivotOrder[i], pivotOrder[pivotIndex]);
+		std::swap(rowIds[i], rowIds[pivotIndex]);
+		rowPositions[rowIds[i]] = i;
+		rowPositions[rowIds[pivotIndex]] = pivotIndex;
 		auto pivotRow = _upper.getRowValuesAndColumns(i, i + 1);
 
-		for (auto j = i + 1; j < _dimension; ++j)
+		for (auto id : candidateRowIds)
 		{
+			auto j = rowPositions[id];
+
+			if (j == i)
+				continue;
+
 			const ComplexFloating &currentValue = _upper(j, i);
 			auto factor = currentValue/pivotElement;
 
 			if (currentValue == zero)
 				continue;
+
+			auto iterator = _upper.getRowIterator(j, i + 1);
+
+			for (auto const &columnAndValue : pivotRow)
+			{
+				while (iterator.isValid() && iterator.getColumn() < columnAndValue.first)
+					iterator.next();
+
+				if (!iterator.isValid() || iterator.getColumn() != columnAndValue.first)
+					rowIdsOfColumns[columnAndValue.first].push_back(id);
+			}
 			
 			auto factorNegative = factor*ComplexFloating(Floating(-1));
 			_upper.addWeightedRowElements(j, factorNegative, pivotRow);
@@ -127,38 +357,317 @@ void LUDecomposition<Floating, ComplexFloating>::calculateDecomposition(SparseMa
 		_left.set(i, i, one);
 
 	_upper.compress();
+	_upper.freeze();
+	_left.freeze();
+
+	std::vector<std::vector<int>> systemMatrixColumns(_dimension);
+
+	for (auto row = 0; row < _dimension; ++row)
+		for (auto iterator = systemMatrix.getRowIterator(row); iterator.isValid(); iterator.next())
+			systemMatrixColumns[row].push_back(iterator.getColumn());
+
+	delete _symbolic;
+	_symbolic = new LUDecompositionSymbolic(systemMatrixColumns, _ordering, permutationOrder, pivotOrder);
+	createPermutations();
+	calculateLevels();
 }
 
 template<class Floating, class ComplexFloating>
-Vector<Floating, ComplexFloating> LUDecomposition<Floating, ComplexFloating>::forwardSubstitution(Vector<Floating, ComplexFloating> const &b) const
+bool LUDecomposition<Floating, ComplexFloating>::calculateNumericDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix)
 {
-	Vector<Floating, ComplexFloating> y(_dimension);
-	Vector<Floating, ComplexFloating> bPermutated(_dimension);
-	_permutation.multiply(bPermutated, b);
-	y.set(0, bPermutated(0));
+	if (!hasSymbolicPattern(systemMatrix))
+		return false;
+
+	auto const &symbolic = *_symbolic;
+	auto one = ComplexFloating(Floating(1));
+	auto zero = ComplexFloating(Floating(0));
+	std::vector<ComplexFloating> work(_dimension, zero);
+	std::vector<std::vector<ComplexFloating>> upperValues(_dimension);
+	std::vector<Floating> columnMaximumsSystemMatrix(_dimension, Floating(0));
+	std::vector<Floating> columnMaximumsUpper(_dimension, Floating(0));
+	_left = SparseMatrix<Floating, ComplexFloating>(_dimension, _dimension);
+	_upper = SparseMatrix<Floating, ComplexFloating>(_dimension, _dimension);
 
-	for (auto i = 1; i < _dimension; ++i)
+	// up-looking elimination along the precalculated pattern, therefore no pivot search and no fill-in discovery is necessary
+	for (auto row = 0; row < _dimension; ++row)
 	{
-		auto rowSum = _left.multiplyRowWithEndColumn(i, y, i - 1);
-		auto value = bPermutated(i) - rowSum;
-		y.set(i, value);
+		auto const &upperColumns = symbolic.getUpperColumns(row);
+		auto &values = upperValues[row];
+
+		for (auto iterator = systemMatrix.getRowIterator(symbolic.getSystemMatrixRow(row)); iterator.isValid(); iterator.next())
+		{
+			auto column = symbolic.getPermutatedColumn(iterator.getColumn());
+			work[column] = iterator.getValue();
+			columnMaximumsSystemMatrix[column] = std::max(columnMaximumsSystemMatrix[column], std::abs(iterator.getValue()));
+		}
+
+		for (auto pivotRow : symbolic.getLeftColumns(row))
+		{
+			auto const &pivotColumns = symbolic.getUpperColumns(pivotRow);
+			auto const &pivotValues = upperValues[pivotRow];
+			auto factor = work[pivotRow]/pivotValues[0];
+			work[pivotRow] = zero;
+
+			if (factor == zero)
+				continue;
+
+			_left.set(row, pivotRow, factor);
+
+			for (size_t i = 1; i < pivotColumns.size(); ++i)
+				work[pivotColumns[i]].subtractProduct(factor, pivotValues[i]);
+		}
+
+		values.reserve(upperColumns.size());
+
+		for (auto column : upperColumns)
+		{
+			values.push_back(work[column]);
+			columnMaximumsUpper[column] = std::max(columnMaximumsUpper[column], std::abs(work[column]));
+			work[column] = zero;
+		}
+
+		if (values[0] == zero)
+			return false;
+
+		_left.set(row, row, one);
+
+		for (size_t i = 0; i < upperColumns.size(); ++i)
+			if (values[i] != zero)
+				_upper.set(row, upperColumns[i], values[i]);
 	}
-	
-	return y;
+
+	// the pivot order was chosen for other values, therefore the pivot growth has to be checked
+	auto minimumReciprocalPivotGrowth = std::sqrt(NumericalTraits<Floating>::epsilon());
+
+	for (auto column = 0; column < _dimension; ++column)
+		if (columnMaximumsSystemMatrix[column] < minimumReciprocalPivotGrowth*columnMaximumsUpper[column])
+			return false;
+
+	_upper.freeze();
+	_left.freeze();
+	createPermutations();
+	calculateLevels();
+	return true;
 }
 
 template<class Floating, class ComplexFloating>
-Vector<Floating, ComplexFloating> LUDecomposition<Floating, ComplexFloating>::backwardSubstitution(Vector<Floating, ComplexFloating> const &y) const
+bool LUDecomposition<Floating, ComplexFloating>::hasSymbolicPattern(SparseMatrix<Floating, ComplexFloating> const &systemMatrix) const
 {
-	Vector<Floating, ComplexFloating> x(_dimension);
-	x.set(_dimension - 1, y(_dimension - 1)/_upper(_dimension - 1, _dimension - 1));
+	if (_symbolic == 0 || _symbolic->getDimension() != _dimension)
+		return false;
+
+	if (systemMatrix.getRowCount() != _dimension || systemMatrix.getColumnCount() != _dimension)
+		return false;
 
-	for (auto i = _dimension - 2; i >= 0; --i)
+	for (auto row = 0; row < _dimension; ++row)
 	{
-		auto rowSum = _upper.multiplyRowWithStartColumn(i, x, i + 1);
-		auto value = (y(i) - rowSum)/_upper(i, i);
-		x.set(i, value);
+		auto const &columns = _symbolic->getSystemMatrixColumns(row);
+		auto iterator = systemMatrix.getRowIterator(row);
+
+		if (iterator.getNonZeroCount() != static_cast<int>(columns.size()))
+			return false;
+
+		for (auto column : columns)
+		{
+			if (iterator.getColumn() != column)
+				return false;
+
+			iterator.next();
+		}
+	}
+
+	return true;
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::createPermutations()
+{
+	_permutation = _symbolic->getPivotPermutation();
+	_permutationBandwidthReduction = _symbolic->getOrdering();
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::calculateLevels()
+{
+	_forwardLevels = LevelSchedule<Floating, ComplexFloating>::createForward(_left);
+	_backwardLevels = LevelSchedule<Floating, ComplexFloating>::createBackward(_upper);
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::forwardSubstitution(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> &y) const
+{
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	// the pivot permutation is applied while reading the right hand side
+	for (auto levelIndex = 0; levelIndex < _forwardLevels.getLevelCount(); ++levelIndex)
+	{
+		auto const &level = _forwardLevels.getLevel(levelIndex);
+		int rowCount = level.size();
+
+		#pragma omp parallel if(_forwardLevels.isParallel(levelIndex))
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto j = 0; j < rowCount; ++j)
+			{
+				auto i = level[j];
+
+				if (i == 0)
+				{
+					y.set(0, b(_permutation[0]));
+					continue;
+				}
+
+				auto rowSum = _left.multiplyRowWithEndColumn(i, y, i - 1);
+				auto value = b(_permutation[i]) - rowSum;
+				y.set(i, value);
+			}
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::backwardSubstitution(Vector<Floating, ComplexFloating> const &y, Vector<Floating, ComplexFloating> &x) const
+{
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	for (auto levelIndex = 0; levelIndex < _backwardLevels.getLevelCount(); ++levelIndex)
+	{
+		auto const &level = _backwardLevels.getLevel(levelIndex);
+		int rowCount = level.size();
+
+		#pragma omp parallel if(_backwardLevels.isParallel(levelIndex))
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto j = 0; j < rowCount; ++j)
+			{
+				auto i = level[j];
+
+				if (i == _dimension - 1)
+				{
+					x.set(i, y(i)/_upper(i, i));
+					continue;
+				}
+
+				auto rowSum = _upper.multiplyRowWithStartColumn(i, x, i + 1);
+				auto value = (y(i) - rowSum)/_upper(i, i);
+				x.set(i, value);
+			}
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::forwardSubstitutionMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &y, std::vector<size_t> const &indices) const
+{
+	auto count = indices.size();
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	// every row of the left matrix is traversed only once for all right hand sides
+	for (auto levelIndex = 0; levelIndex < _forwardLevels.getLevelCount(); ++levelIndex)
+	{
+		auto const &level = _forwardLevels.getLevel(levelIndex);
+		int rowCount = level.size();
+
+		#pragma omp parallel if(_forwardLevels.isParallel(levelIndex))
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			auto thread = omp_get_thread_num();
+			assert(thread < static_cast<int>(_summandsRealMultiple.size()));
+			auto &summandsReal = _summandsRealMultiple[thread];
+			auto &summandsImaginary = _summandsImaginaryMultiple[thread];
+			ComplexFloating summand;
+
+			#pragma omp for
+			for (auto j = 0; j < rowCount; ++j)
+			{
+				auto i = level[j];
+
+				for (size_t k = 0; k < count; ++k)
+				{
+					summandsReal[k].reset();
+					summandsImaginary[k].reset();
+				}
+
+				for (auto iterator = _left.getRowIterator(i); iterator.isValid() && iterator.getColumn() < i; iterator.next())
+				{
+					auto const &value = iterator.getValue();
+					auto column = iterator.getColumn();
+
+					for (size_t k = 0; k < count; ++k)
+					{
+						summand.assignProduct(value, y[indices[k]](column));
+						summandsReal[k].add(summand.real());
+						summandsImaginary[k].add(summand.imag());
+					}
+				}
+
+				for (size_t k = 0; k < count; ++k)
+					y[indices[k]].set(i, b[indices[k]](_permutation[i]) - ComplexFloating(summandsReal[k].getResult(), summandsImaginary[k].getResult()));
+			}
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+void LUDecomposition<Floating, ComplexFloating>::backwardSubstitutionMultiple(std::vector<Vector<Floating, ComplexFloating>> const &y, std::vector<Vector<Floating, ComplexFloating>> &x, std::vector<size_t> const &indices) const
+{
+	auto count = indices.size();
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	for (auto levelIndex = 0; levelIndex < _backwardLevels.getLevelCount(); ++levelIndex)
+	{
+		auto const &level = _backwardLevels.getLevel(levelIndex);
+		int rowCount = level.size();
+
+		#pragma omp parallel if(_backwardLevels.isParallel(levelIndex))
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			auto thread = omp_get_thread_num();
+			assert(thread < static_cast<int>(_summandsRealMultiple.size()));
+			auto &summandsReal = _summandsRealMultiple[thread];
+			auto &summandsImaginary = _summandsImaginaryMultiple[thread];
+			ComplexFloating summand;
+
+			#pragma omp for
+			for (auto j = 0; j < rowCount; ++j)
+			{
+				auto i = level[j];
+				auto diagonal = ComplexFloating();
+
+				for (size_t k = 0; k < count; ++k)
+				{
+					summandsReal[k].reset();
+					summandsImaginary[k].reset();
+				}
+
+				for (auto iterator = _upper.getRowIterator(i); iterator.isValid(); iterator.next())
+				{
+					auto const &value = iterator.getValue();
+					auto column = iterator.getColumn();
+
+					if (column == i)
+						diagonal = value;
+
+					if (column <= i)
+						continue;
+
+					for (size_t k = 0; k < count; ++k)
+					{
+						summand.assignProduct(value, x[indices[k]](column));
+						summandsReal[k].add(summand.real());
+						summandsImaginary[k].add(summand.imag());
+					}
+				}
+
+				for (size_t k = 0; k < count; ++k)
+					x[indices[k]].set(i, (y[indices[k]](i) - ComplexFloating(summandsReal[k].getResult(), summandsImaginary[k].getResult()))/diagonal);
+			}
+		}
 	}
-	
-	return x;
 }
\ No newline at end of file
@@ -3,32 +3,73 @@
 #include "ILinearEquationSystemSolver.h"
 #include "SparseMatrix.h"
 #include "IPivotFinder.h"
+#include "LUDecompositionSymbolic.h"
+#include "LevelSchedule.h"
 
 template<class Floating, class ComplexFloating>
 class LUDecomposition :
 	public ILinearEquationSystemSolver<Floating, ComplexFloating>
 {
 protected:
-	LUDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, IPivotFinder<Floating, ComplexFloating> *pivotFinder);
+	LUDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionOrdering ordering, IPivotFinder<Floating, ComplexFloating> *pivotFinder);
+	LUDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionSymbolic const &symbolic, IPivotFinder<Floating, ComplexFloating> *pivotFinder);
 
 public:
 	virtual ~LUDecomposition();
 	virtual Vector<Floating, ComplexFloating> solve(const Vector<Floating, ComplexFloating> &b) const;
+	virtual void solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const;
+	virtual std::vector<Vector<Floating, ComplexFloating>> solveMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b) const;
+	virtual void solveMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &x) const;
+	void refactorize(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
+	LUDecompositionSymbolic const& getSymbolic() const;
+	int getNonZeroCount() const;
+	int getForwardLevelCount() const;
+	int getBackwardLevelCount() const;
 
 private:
-	Vector<Floating, ComplexFloating> solveInternal(const Vector<Floating, ComplexFloating> &b) const;
+	void solveInternal(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const;
 	Floating calculateError(const Vector<Floating, ComplexFloating> &x, const Vector<Floating, ComplexFloating> &b, ComplexFloating const &bSquaredNorm, Vector<Floating, ComplexFloating> &residual) const;
 	void calculateDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
-	Vector<Floating, ComplexFloating> forwardSubstitution(Vector<Floating, ComplexFloating> const &b) const;
-	Vector<Floating, ComplexFloating> backwardSubstitution(Vector<Floating, ComplexFloating> const &y) const;
+	bool calculateNumericDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
+	bool hasSymbolicPattern(SparseMatrix<Floating, ComplexFloating> const &systemMatrix) const;
+	void createPermutations();
+	void calculateLevels();
+	void forwardSubstitution(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> &y) const;
+	void backwardSubstitution(Vector<Floating, ComplexFloating> const &y, Vector<Floating, ComplexFloating> &x) const;
+	void reserveWorkspacesMultiple(size_t count) const;
+	void solveInternalMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &x, std::vector<size_t> const &indices) const;
+	void forwardSubstitutionMultiple(std::vector<Vector<Floating, ComplexFloating>> const &b, std::vector<Vector<Floating, ComplexFloating>> &y, std::vector<size_t> const &indices) const;
+	void backwardSubstitutionMultiple(std::vector<Vector<Floating, ComplexFloating>> const &y, std::vector<Vector<Floating, ComplexFloating>> &x, std::vector<size_t> const &indices) const;
 
 private:
 	const int _dimension;
+	const LUDecompositionOrdering _ordering;
 	SparseMatrix<Floating, ComplexFloating> _left;
 	SparseMatrix<Floating, ComplexFloating> _upper;
-	SparseMatrix<Floating, ComplexFloating> _permutation;
-	SparseMatrix<Floating, ComplexFloating> _permutationBandwidthReduction;
-	SparseMatrix<Floating, ComplexFloating> _permutationBandwidthReductionInverse;
+	std::vector<int> _permutation;
+	std::vector<int> _permutationBandwidthReduction;
 	const IPivotFinder<Floating, ComplexFloating> *_pivotFinder;
+	LUDecompositionSymbolic *_symbolic;
+	LevelSchedule<Floating, ComplexFloating> _forwardLevels;
+	LevelSchedule<Floating, ComplexFloating> _backwardLevels;
+	mutable Vector<Floating, ComplexFloating> _bPermutated;
+	mutable Vector<Floating, ComplexFloating> _xPermutated;
+	mutable Vector<Floating, ComplexFloating> _xImproved;
+	mutable Vector<Floating, ComplexFloating> _improvement;
+	mutable Vector<Floating, ComplexFloating> _residual;
+	mutable Vector<Floating, ComplexFloating> _y;
+	mutable Vector<Floating, ComplexFloating> _upperProduct;
+	mutable Vector<Floating, ComplexFloating> _leftProduct;
+	mutable std::vector<Vector<Floating, ComplexFloating>> _bPermutatedMultiple;
+	mutable std::vector<Vector<Floating, ComplexFloating>> _xPermutatedMultiple;
+	mutable std::vector<Vector<Floating, ComplexFloating>> _improvementsMultiple;
+	mutable std::vector<Vector<Floating, ComplexFloating>> _residualsMultiple;
+	mutable std::vector<Vector<Floating, ComplexFloating>> _yMultiple;
+	mutable std::vector<ComplexFloating> _bSquaredNormsMultiple;
+	mutable std::vector<Floating> _lastErrorsMultiple;
+	mutable std::vector<size_t> _activeMultiple;
+	mutable std::vector<size_t> _stillImprovingMultiple;
+	mutable std::vector<std::vector<SummationNeumaier<Floating>>> _summandsRealMultiple;
+	mutable std::vector<std::vector<SummationNeumaier<Floating>>> _summandsImaginaryMultiple;
 };
 
@@ -0,0 +1,7 @@
+#pragma once
+
+enum LUDecompositionOrdering
+{
+	LUDecompositionOrderingReverseCuthillMcKee,
+	LUDecompositionOrderingMinimumDegree
+};
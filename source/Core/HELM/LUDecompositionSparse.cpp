@@ -1,12 +1,27 @@
 #include "LUDecompositionSparse.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "PivotFinderSmallestFillIn.h"
 
 template class LUDecompositionSparse<long double, Complex<long double>>;
 template class LUDecompositionSparse<MultiPrecision, Complex<MultiPrecision>>;
+template class LUDecompositionSparse<DoubleDouble, Complex<DoubleDouble>>;
+template class LUDecompositionSparse<QuadDouble, Complex<QuadDouble>>;
+template class LUDecompositionSparse<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
 LUDecompositionSparse<Floating, ComplexFloating>::LUDecompositionSparse(SparseMatrix<Floating, ComplexFloating> const &systemMatrix) :
-	LUDecomposition<Floating, ComplexFloating>(systemMatrix, new PivotFinderSmallestFillIn<Floating, ComplexFloating>())
+	LUDecomposition<Floating, ComplexFloating>(systemMatrix, LUDecompositionOrderingReverseCuthillMcKee, new PivotFinderSmallestFillIn<Floating, ComplexFloating>())
+{ }
+
+template<class Floating, class ComplexFloating>
+LUDecompositionSparse<Floating, ComplexFloating>::LUDecompositionSparse(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionOrdering ordering) :
+	LUDecomposition<Floating, ComplexFloating>(systemMatrix, ordering, new PivotFinderSmallestFillIn<Floating, ComplexFloating>())
+{ }
+
+template<class Floating, class ComplexFloating>
+LUDecompositionSparse<Floating, ComplexFloating>::LUDecompositionSparse(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionSymbolic const &symbolic) :
+	LUDecomposition<Floating, ComplexFloating>(systemMatrix, symbolic, new PivotFinderSmallestFillIn<Floating, ComplexFloating>())
 { }
@@ -8,5 +8,7 @@ class LUDecompositionSparse :
 {
 public:
 	LUDecompositionSparse(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
+	LUDecompositionSparse(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionOrdering ordering);
+	LUDecompositionSparse(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionSymbolic const &symbolic);
 };
 
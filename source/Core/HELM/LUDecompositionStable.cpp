@@ -1,12 +1,27 @@
 #include "LUDecompositionStable.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "PivotFinderBiggestElement.h"
 
 template class LUDecompositionStable<long double, Complex<long double>>;
 template class LUDecompositionStable<MultiPrecision, Complex<MultiPrecision>>;
+template class LUDecompositionStable<DoubleDouble, Complex<DoubleDouble>>;
+template class LUDecompositionStable<QuadDouble, Complex<QuadDouble>>;
+template class LUDecompositionStable<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
 LUDecompositionStable<Floating, ComplexFloating>::LUDecompositionStable(SparseMatrix<Floating, ComplexFloating> const &systemMatrix) :
-	LUDecomposition<Floating, ComplexFloating>(systemMatrix, new PivotFinderBiggestElement<Floating, ComplexFloating>())
+	LUDecomposition<Floating, ComplexFloating>(systemMatrix, LUDecompositionOrderingReverseCuthillMcKee, new PivotFinderBiggestElement<Floating, ComplexFloating>())
+{ }
+
+template<class Floating, class ComplexFloating>
+LUDecompositionStable<Floating, ComplexFloating>::LUDecompositionStable(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionOrdering ordering) :
+	LUDecomposition<Floating, ComplexFloating>(systemMatrix, ordering, new PivotFinderBiggestElement<Floating, ComplexFloating>())
+{ }
+
+template<class Floating, class ComplexFloating>
+LUDecompositionStable<Floating, ComplexFloating>::LUDecompositionStable(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionSymbolic const &symbolic) :
+	LUDecomposition<Floating, ComplexFloating>(systemMatrix, symbolic, new PivotFinderBiggestElement<Floating, ComplexFloating>())
 { }
\ No newline at end of file
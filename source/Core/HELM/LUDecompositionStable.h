@@ -8,5 +8,7 @@ class LUDecompositionStable :
 {
 public:
 	LUDecompositionStable(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
+	LUDecompositionStable(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionOrdering ordering);
+	LUDecompositionStable(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, LUDecompositionSymbolic const &symbolic);
 };
 
@@ -0,0 +1,143 @@
+#include "LUDecompositionSymbolic.h"
+#include <queue>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include <assert.h>
+
+LUDecompositionSymbolic::LUDecompositionSymbolic(std::vector<std::vector<int>> const &systemMatrixColumns, LUDecompositionOrdering orderingMethod, std::vector<int> const &ordering, std::vector<int> const &pivotPermutation) :
+	_dimension(systemMatrixColumns.size()),
+	_orderingMethod(orderingMethod),
+	_systemMatrixColumns(systemMatrixColumns),
+	_ordering(ordering),
+	_orderingInverse(ordering.size(), -1),
+	_pivotPermutation(pivotPermutation),
+	_leftColumns(systemMatrixColumns.size()),
+	_upperColumns(systemMatrixColumns.size())
+{
+	if (static_cast<int>(ordering.size()) != _dimension || static_cast<int>(pivotPermutation.size()) != _dimension)
+		throw std::invalid_argument("sizes of the permutations do not match the dimension");
+
+	for (auto i = 0; i < _dimension; ++i)
+		_orderingInverse[_ordering[i]] = i;
+
+	calculateFillIn();
+}
+
+int LUDecompositionSymbolic::getDimension() const
+{
+	return _dimension;
+}
+
+LUDecompositionOrdering LUDecompositionSymbolic::getOrderingMethod() const
+{
+	return _orderingMethod;
+}
+
+int LUDecompositionSymbolic::getSystemMatrixRow(int row) const
+{
+	return _ordering[_pivotPermutation[row]];
+}
+
+int LUDecompositionSymbolic::getPermutatedColumn(int systemMatrixColumn) const
+{
+	return _orderingInverse[systemMatrixColumn];
+}
+
+std::vector<int> const& LUDecompositionSymbolic::getSystemMatrixColumns(int systemMatrixRow) const
+{
+	return _systemMatrixColumns[systemMatrixRow];
+}
+
+std::vector<int> const& LUDecompositionSymbolic::getOrdering() const
+{
+	return _ordering;
+}
+
+std::vector<int> const& LUDecompositionSymbolic::getPivotPermutation() const
+{
+	return _pivotPermutation;
+}
+
+std::vector<int> const& LUDecompositionSymbolic::getLeftColumns(int row) const
+{
+	return _leftColumns[row];
+}
+
+std::vector<int> const& LUDecompositionSymbolic::getUpperColumns(int row) const
+{
+	return _upperColumns[row];
+}
+
+int LUDecompositionSymbolic::getLeftNonZeroCount() const
+{
+	auto result = 0;
+
+	for (auto i = 0; i < _dimension; ++i)
+		result += _leftColumns[i].size();
+
+	return result;
+}
+
+int LUDecompositionSymbolic::getUpperNonZeroCount() const
+{
+	auto result = 0;
+
+	for (auto i = 0; i < _dimension; ++i)
+		result += _upperColumns[i].size();
+
+	return result;
+}
+
+void LUDecompositionSymbolic::calculateFillIn()
+{
+	std::vector<int> marker(_dimension, -1);
+	std::priority_queue<int, std::vector<int>, std::greater<int>> pendingColumns;
+
+	for (auto row = 0; row < _dimension; ++row)
+	{
+		auto &left = _leftColumns[row];
+		auto &upper = _upperColumns[row];
+		marker[row] = row;
+		upper.push_back(row);
+
+		for (auto column : _systemMatrixColumns[getSystemMatrixRow(row)])
+		{
+			auto permutatedColumn = getPermutatedColumn(column);
+
+			if (marker[permutatedColumn] == row)
+				continue;
+
+			marker[permutatedColumn] = row;
+
+			if (permutatedColumn < row)
+				pendingColumns.push(permutatedColumn);
+			else
+				upper.push_back(permutatedColumn);
+		}
+
+		// the rows above are processed in ascending order, as every fill-in they cause lies right of them
+		while (!pendingColumns.empty())
+		{
+			auto pivotRow = pendingColumns.top();
+			pendingColumns.pop();
+			left.push_back(pivotRow);
+
+			for (auto column : _upperColumns[pivotRow])
+			{
+				if (marker[column] == row)
+					continue;
+
+				marker[column] = row;
+
+				if (column < row)
+					pendingColumns.push(column);
+				else
+					upper.push_back(column);
+			}
+		}
+
+		std::sort(upper.begin(), upper.end());
+		assert(upper.front() == row);
+	}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <vector>
+#include "LUDecompositionOrdering.h"
+
+class LUDecompositionSymbolic
+{
+public:
+	LUDecompositionSymbolic(std::vector<std::vector<int>> const &systemMatrixColumns, LUDecompositionOrdering orderingMethod, std::vector<int> const &ordering, std::vector<int> const &pivotPermutation);
+
+	int getDimension() const;
+	LUDecompositionOrdering getOrderingMethod() const;
+	int getSystemMatrixRow(int row) const;
+	int getPermutatedColumn(int systemMatrixColumn) const;
+	std::vector<int> const& getSystemMatrixColumns(int systemMatrixRow) const;
+	std::vector<int> const& getOrdering() const;
+	std::vector<int> const& getPivotPermutation() const;
+	std::vector<int> const& getLeftColumns(int row) const;
+	std::vector<int> const& getUpperColumns(int row) const;
+	int getLeftNonZeroCount() const;
+	int getUpperNonZeroCount() const;
+
+private:
+	void calculateFillIn();
+
+private:
+	const int _dimension;
+	const LUDecompositionOrdering _orderingMethod;
+	std::vector<std::vector<int>> _systemMatrixColumns;
+	std::vector<int> _ordering;
+	std::vector<int> _orderingInverse;
+	std::vector<int> _pivotPermutation;
+	std::vector<std::vector<int>> _leftColumns;
+	std::vector<std::vector<int>> _upperColumns;
+};
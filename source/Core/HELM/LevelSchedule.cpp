@@ -0,0 +1,74 @@
+#include "LevelSchedule.h"
+#include "Complex.h"
+#include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include <algorithm>
+#include <assert.h>
+
+template class LevelSchedule<long double, Complex<long double>>;
+template class LevelSchedule<MultiPrecision, Complex<MultiPrecision>>;
+template class LevelSchedule<DoubleDouble, Complex<DoubleDouble>>;
+template class LevelSchedule<QuadDouble, Complex<QuadDouble>>;
+template class LevelSchedule<double, Complex<double>>;
+
+template<class Floating, class ComplexFloating>
+LevelSchedule<Floating, ComplexFloating>::LevelSchedule()
+{ }
+
+template<class Floating, class ComplexFloating>
+LevelSchedule<Floating, ComplexFloating>::LevelSchedule(std::vector<int> const &rowLevels)
+{
+	auto levelCount = rowLevels.empty() ? 0 : *std::max_element(rowLevels.begin(), rowLevels.end()) + 1;
+	_levels.resize(levelCount);
+
+	for (auto row = 0; row < static_cast<int>(rowLevels.size()); ++row)
+		_levels[rowLevels[row]].push_back(row);
+}
+
+template<class Floating, class ComplexFloating>
+LevelSchedule<Floating, ComplexFloating> LevelSchedule<Floating, ComplexFloating>::createForward(SparseMatrix<Floating, ComplexFloating> const &lower)
+{
+	assert(lower.getRowCount() == lower.getColumnCount());
+	auto dimension = lower.getRowCount();
+	std::vector<int> rowLevels(dimension, 0);
+
+	for (auto row = 0; row < dimension; ++row)
+		for (auto iterator = lower.getRowIterator(row); iterator.isValid() && iterator.getColumn() < row; iterator.next())
+			rowLevels[row] = std::max(rowLevels[row], rowLevels[iterator.getColumn()] + 1);
+
+	return LevelSchedule(rowLevels);
+}
+
+template<class Floating, class ComplexFloating>
+LevelSchedule<Floating, ComplexFloating> LevelSchedule<Floating, ComplexFloating>::createBackward(SparseMatrix<Floating, ComplexFloating> const &upper)
+{
+	assert(upper.getRowCount() == upper.getColumnCount());
+	auto dimension = upper.getRowCount();
+	std::vector<int> rowLevels(dimension, 0);
+
+	for (auto row = dimension - 1; row >= 0; --row)
+		for (auto iterator = upper.getRowIterator(row); iterator.isValid(); iterator.next())
+			if (iterator.getColumn() > row)
+				rowLevels[row] = std::max(rowLevels[row], rowLevels[iterator.getColumn()] + 1);
+
+	return LevelSchedule(rowLevels);
+}
+
+template<class Floating, class ComplexFloating>
+int LevelSchedule<Floating, ComplexFloating>::getLevelCount() const
+{
+	return static_cast<int>(_levels.size());
+}
+
+template<class Floating, class ComplexFloating>
+std::vector<int> const& LevelSchedule<Floating, ComplexFloating>::getLevel(int level) const
+{
+	return _levels[level];
+}
+
+template<class Floating, class ComplexFloating>
+bool LevelSchedule<Floating, ComplexFloating>::isParallel(int level) const
+{
+	return static_cast<int>(_levels[level].size()) >= _minimumParallelLevelSize;
+}
\ No newline at end of file
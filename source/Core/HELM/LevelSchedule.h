@@ -0,0 +1,30 @@
+#pragma once
+
+#include <vector>
+#include "SparseMatrix.h"
+
+// groups the rows of a triangular matrix into levels, a row depends only on the rows of the previous levels,
+// therefore the rows of one level can be solved in parallel during a forward or backward substitution
+template<class Floating, class ComplexFloating>
+class LevelSchedule
+{
+public:
+	LevelSchedule();
+
+	static LevelSchedule createForward(SparseMatrix<Floating, ComplexFloating> const &lower);
+	static LevelSchedule createBackward(SparseMatrix<Floating, ComplexFloating> const &upper);
+
+	int getLevelCount() const;
+	std::vector<int> const& getLevel(int level) const;
+	bool isParallel(int level) const;
+
+private:
+	LevelSchedule(std::vector<int> const &rowLevels);
+
+private:
+	std::vector<std::vector<int>> _levels;
+
+private:
+	// levels with fewer rows are not worth the overhead of a parallel region
+	static const int _minimumParallelLevelSize = 64;
+};
\ No newline at end of file
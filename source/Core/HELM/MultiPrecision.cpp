@@ -1,6 +1,37 @@
 #include "MultiPrecision.h"
+#include <atomic>
+#include <algorithm>
+#include <assert.h>
 
-unsigned int MultiPrecision::_precision = 300;
+thread_local unsigned int MultiPrecision::_precision = 300;
+
+static std::atomic<long long> allocationCount(0);
+static void* (*originalAllocate)(size_t) = 0;
+static void* (*originalReallocate)(void*, size_t, size_t) = 0;
+static void (*originalFree)(void*, size_t) = 0;
+
+static void* allocateCounted(size_t size)
+{
+	++allocationCount;
+	return originalAllocate(size);
+}
+
+static void* reallocateCounted(void *pointer, size_t oldSize, size_t newSize)
+{
+	++allocationCount;
+	return originalReallocate(pointer, oldSize, newSize);
+}
+
+static void freeCounted(void *pointer, size_t size)
+{
+	originalFree(pointer, size);
+}
+
+// the result gets the precision of the more accurate operand, like the expression templates of mpf_class
+static MultiPrecision createResult(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	return MultiPrecision(0.0, static_cast<int>(std::max(lhs.getValue().get_prec(), rhs.getValue().get_prec())));
+}
 
 MultiPrecision::MultiPrecision() :
 	_value(0, _precision)
@@ -49,12 +80,29 @@ MultiPrecision::operator int() const
 	return static_cast<int>(_value.get_d());
 }
 
+// the result gets the default precision of the current thread, like a new value, therefore a value never keeps the precision of a previous calculation,
+// the limbs are only reallocated if the precision changes
 MultiPrecision& MultiPrecision::operator=(const MultiPrecision &rhs)
 {
+	auto precision = getValuePrecision();
+
+	if (_value.get_prec() != precision)
+		_value.set_prec(precision);
+
 	_value = rhs.getValue();
 	return *this;
 }
 
+// the limbs are exchanged instead of copied, if the value already has the default precision of the current thread
+MultiPrecision& MultiPrecision::operator=(MultiPrecision &&rhs)
+{
+	if (rhs.getValue().get_prec() != getValuePrecision())
+		return *this = static_cast<MultiPrecision const&>(rhs);
+
+	mpf_swap(_value.get_mpf_t(), rhs._value.get_mpf_t());
+	return *this;
+}
+
 MultiPrecision& MultiPrecision::operator+=(const MultiPrecision &rhs)
 {
 	_value += rhs.getValue();
@@ -91,27 +139,71 @@ const MultiPrecision MultiPrecision::operator+() const
 
 const MultiPrecision MultiPrecision::operator-() const
 {
-	return MultiPrecision(-_value);
+	MultiPrecision result(0.0, static_cast<int>(_value.get_prec()));
+	mpf_neg(result._value.get_mpf_t(), _value.get_mpf_t());
+	return result;
+}
+
+void MultiPrecision::assignSum(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	mpf_add(_value.get_mpf_t(), lhs.getValue().get_mpf_t(), rhs.getValue().get_mpf_t());
+}
+
+void MultiPrecision::assignDifference(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	mpf_sub(_value.get_mpf_t(), lhs.getValue().get_mpf_t(), rhs.getValue().get_mpf_t());
+}
+
+void MultiPrecision::assignProduct(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	mpf_mul(_value.get_mpf_t(), lhs.getValue().get_mpf_t(), rhs.getValue().get_mpf_t());
+}
+
+void MultiPrecision::assignQuotient(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	mpf_div(_value.get_mpf_t(), lhs.getValue().get_mpf_t(), rhs.getValue().get_mpf_t());
+}
+
+void MultiPrecision::addProduct(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	auto &product = getProductScratch(std::max(lhs.getValue().get_prec(), rhs.getValue().get_prec()));
+	mpf_mul(product.get_mpf_t(), lhs.getValue().get_mpf_t(), rhs.getValue().get_mpf_t());
+	mpf_add(_value.get_mpf_t(), _value.get_mpf_t(), product.get_mpf_t());
+}
+
+void MultiPrecision::subtractProduct(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	auto &product = getProductScratch(std::max(lhs.getValue().get_prec(), rhs.getValue().get_prec()));
+	mpf_mul(product.get_mpf_t(), lhs.getValue().get_mpf_t(), rhs.getValue().get_mpf_t());
+	mpf_sub(_value.get_mpf_t(), _value.get_mpf_t(), product.get_mpf_t());
 }
 
 const MultiPrecision operator+(const MultiPrecision &lhs, const MultiPrecision &rhs)
 {
-	return MultiPrecision(lhs.getValue() + rhs.getValue());
+	auto result = createResult(lhs, rhs);
+	result.assignSum(lhs, rhs);
+	return result;
 }
 
 const MultiPrecision operator-(const MultiPrecision &lhs, const MultiPrecision &rhs)
 {
-	return MultiPrecision(lhs.getValue() - rhs.getValue());
+	auto result = createResult(lhs, rhs);
+	result.assignDifference(lhs, rhs);
+	return result;
 }
 
 const MultiPrecision operator*(const MultiPrecision &lhs, const MultiPrecision &rhs)
 {
-	return MultiPrecision(lhs.getValue() * rhs.getValue());
+	auto result = createResult(lhs, rhs);
+	result.assignProduct(lhs, rhs);
+	return result;
 }
 
 const MultiPrecision operator/(const MultiPrecision &lhs, const MultiPrecision &rhs)
 {
-	return MultiPrecision(lhs.getValue() / rhs.getValue());
+	auto result = createResult(lhs, rhs);
+	result.assignQuotient(lhs, rhs);
+	return result;
 }
 
 bool operator<(const MultiPrecision &lhs, const MultiPrecision &rhs)
@@ -150,6 +242,23 @@ std::ostream& operator<<(std::ostream &stream, MultiPrecision const& value)
 	return stream;
 }
 
+// equivalent to std::abs(lhs) >= std::abs(rhs), but without the two temporaries
+bool isAbsoluteValueGreaterOrEqual(MultiPrecision const &lhs, MultiPrecision const &rhs)
+{
+	auto lhsSign = sgn(lhs.getValue());
+	auto rhsSign = sgn(rhs.getValue());
+
+	if (lhsSign >= 0 && rhsSign >= 0)
+		return cmp(lhs.getValue(), rhs.getValue()) >= 0;
+
+	if (lhsSign <= 0 && rhsSign <= 0)
+		return cmp(lhs.getValue(), rhs.getValue()) <= 0;
+
+	auto &negated = MultiPrecision::getProductScratch(rhs.getValue().get_prec());
+	mpf_neg(negated.get_mpf_t(), rhs.getValue().get_mpf_t());
+	return lhsSign > 0 ? cmp(lhs.getValue(), negated) >= 0 : cmp(lhs.getValue(), negated) <= 0;
+}
+
 MultiPrecision std::abs(MultiPrecision const& value)
 {
 	return MultiPrecision(abs(value.getValue()));
@@ -170,19 +279,73 @@ MultiPrecision std::ceil(MultiPrecision const& value)
 	return MultiPrecision(ceil(value.getValue()));
 }
 
-void MultiPrecision::setDefaultPrecision()
-{
-	mpf_set_default_prec(_precision);
-}
-
 void MultiPrecision::setDefaultPrecision(unsigned int bitPrecision)
 {
 	_precision = bitPrecision;
-	setDefaultPrecision();
 }
 
-
 unsigned int MultiPrecision::getBitPrecision()
 {
 	return _precision;
+}
+
+MultiPrecision& MultiPrecision::getScratch(int index)
+{
+	assert(index >= 0 && index < _scratchCount);
+	thread_local MultiPrecision scratch[_scratchCount];
+	auto &value = scratch[index];
+	auto precision = getValuePrecision();
+
+	if (value.getValue().get_prec() != precision)
+		value._value.set_prec(precision);
+
+	return value;
+}
+
+// used for the intermediate products of the in place kernels, separately from the pool to avoid conflicts with the callers,
+// the precision is always the one of the operands, so that a previous calculation with a higher precision does not affect the result
+MultiPrecision::ValueType& MultiPrecision::getProductScratch(mp_bitcnt_t precision)
+{
+	thread_local ValueType product(0, _precision);
+
+	if (product.get_prec() != precision)
+		product.set_prec(precision);
+
+	return product;
+}
+
+// mpf rounds the precision up to whole limbs and reports the rounded one, which is determined only once for each default precision
+mp_bitcnt_t MultiPrecision::getValuePrecision()
+{
+	thread_local unsigned int bitPrecision = 0;
+	thread_local mp_bitcnt_t valuePrecision = 0;
+
+	if (bitPrecision != _precision)
+	{
+		valuePrecision = ValueType(0, _precision).get_prec();
+		bitPrecision = _precision;
+	}
+
+	return valuePrecision;
+}
+
+// the memory functions of MPIR are global, therefore allocations of other threads are counted as well
+void MultiPrecision::startAllocationCounting()
+{
+	if (originalAllocate == 0)
+		mp_get_memory_functions(&originalAllocate, &originalReallocate, &originalFree);
+
+	allocationCount = 0;
+	mp_set_memory_functions(&allocateCounted, &reallocateCounted, &freeCounted);
+}
+
+void MultiPrecision::stopAllocationCounting()
+{
+	if (originalAllocate != 0)
+		mp_set_memory_functions(originalAllocate, originalReallocate, originalFree);
+}
+
+long long MultiPrecision::getAllocationCount()
+{
+	return allocationCount;
 }
\ No newline at end of file
@@ -21,6 +21,7 @@ public:
 	operator long double() const;
 	operator int() const;
 	MultiPrecision& operator=(const MultiPrecision &rhs);
+	MultiPrecision& operator=(MultiPrecision &&rhs);
 	MultiPrecision& operator+=(const MultiPrecision &rhs);
 	MultiPrecision& operator-=(const MultiPrecision &rhs);
 	MultiPrecision& operator*=(const MultiPrecision &rhs);
@@ -28,14 +29,34 @@ public:
 	ValueType const& getValue() const;
 	const MultiPrecision operator+() const;
 	const MultiPrecision operator-() const;
+	// in place kernels, which reuse the already allocated limbs of this value and are therefore free of heap allocations
+	void assignSum(MultiPrecision const &lhs, MultiPrecision const &rhs);
+	void assignDifference(MultiPrecision const &lhs, MultiPrecision const &rhs);
+	void assignProduct(MultiPrecision const &lhs, MultiPrecision const &rhs);
+	void assignQuotient(MultiPrecision const &lhs, MultiPrecision const &rhs);
+	void addProduct(MultiPrecision const &lhs, MultiPrecision const &rhs);
+	void subtractProduct(MultiPrecision const &lhs, MultiPrecision const &rhs);
 
 public:
-	static void setDefaultPrecision();
+	// the default precision is thread local, therefore calculators with different precisions can run concurrently
 	static void setDefaultPrecision(unsigned int bitPrecision);
 	static unsigned int getBitPrecision();
+	// values of a thread local pool, which are only allocated once per thread
+	static MultiPrecision& getScratch(int index);
+	static void startAllocationCounting();
+	static void stopAllocationCounting();
+	static long long getAllocationCount();
+
+public:
+	static const int _scratchCount = 4;
+
+private:
+	static ValueType& getProductScratch(mp_bitcnt_t precision);
+	static mp_bitcnt_t getValuePrecision();
+	friend bool isAbsoluteValueGreaterOrEqual(MultiPrecision const &lhs, MultiPrecision const &rhs);
 
 private:
-	static unsigned int _precision;
+	static thread_local unsigned int _precision;
 
 private:
 	ValueType _value;
@@ -52,6 +73,7 @@ bool operator<=(const MultiPrecision &lhs, const MultiPrecision &rhs);
 bool operator==(const MultiPrecision &lhs, const MultiPrecision &rhs);
 bool operator!=(const MultiPrecision &lhs, const MultiPrecision &rhs);
 std::ostream& operator<<(std::ostream &stream, MultiPrecision const& value);
+bool isAbsoluteValueGreaterOrEqual(MultiPrecision const &lhs, MultiPrecision const &rhs);
 
 namespace std
 {
@@ -0,0 +1,13 @@
+#include "MultiPrecisionScope.h"
+#include "MultiPrecision.h"
+
+MultiPrecisionScope::MultiPrecisionScope(unsigned int bitPrecision) :
+	_previousBitPrecision(MultiPrecision::getBitPrecision())
+{
+	MultiPrecision::setDefaultPrecision(bitPrecision);
+}
+
+MultiPrecisionScope::~MultiPrecisionScope()
+{
+	MultiPrecision::setDefaultPrecision(_previousBitPrecision);
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+// sets the default precision of MultiPrecision for the current thread, and restores the previous one at the end of the scope,
+// OpenMP does not guarantee that a parallel region runs on the threads of a previous one, therefore each parallel region,
+// which creates temporaries, passes the precision of the encountering thread to a scope of every thread of its team
+class MultiPrecisionScope
+{
+public:
+	explicit MultiPrecisionScope(unsigned int bitPrecision);
+	~MultiPrecisionScope();
+
+private:
+	MultiPrecisionScope(MultiPrecisionScope const &rhs);
+	void operator=(MultiPrecisionScope const &rhs);
+
+private:
+	unsigned int _previousBitPrecision;
+};
\ No newline at end of file
@@ -2,6 +2,8 @@
 
 #include <limits>
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "Complex.h"
 
 using namespace std;
@@ -10,6 +12,16 @@ template<class T>
 class NumericalTraits
 { };
 
+template<>
+class NumericalTraits<double>
+{
+public:
+	static double epsilon()
+	{
+		return numeric_limits<double>::epsilon();
+	}
+};
+
 template<>
 class NumericalTraits<long double>
 {
@@ -30,6 +42,26 @@ public:
 	}
 };
 
+template<>
+class NumericalTraits<DoubleDouble>
+{
+public:
+	static DoubleDouble epsilon()
+	{
+		return DoubleDouble(pow(2, -104.0));
+	}
+};
+
+template<>
+class NumericalTraits<QuadDouble>
+{
+public:
+	static QuadDouble epsilon()
+	{
+		return QuadDouble(pow(2, -209.0));
+	}
+};
+
 
 template<typename T> bool isValueFinite(T const &arg)
 {
@@ -1,12 +1,31 @@
 #include "PivotFinderBiggestElement.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 
 template class PivotFinderBiggestElement<long double, Complex<long double>>;
 template class PivotFinderBiggestElement<MultiPrecision, Complex<MultiPrecision>>;
+template class PivotFinderBiggestElement<DoubleDouble, Complex<DoubleDouble>>;
+template class PivotFinderBiggestElement<QuadDouble, Complex<QuadDouble>>;
+template class PivotFinderBiggestElement<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
-int PivotFinderBiggestElement<Floating, ComplexFloating>::operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row) const
+int PivotFinderBiggestElement<Floating, ComplexFloating>::operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row, std::vector<int> const &candidateRows) const
 {
-	return upper.findAbsoluteMaximumOfColumn(row, row);
+	auto result = row;
+	auto maximum = Floating(0);
+
+	for (auto i : candidateRows)
+	{
+		auto value = std::abs2(upper(i, row));
+
+		if (value > maximum)
+		{
+			result = i;
+			maximum = value;
+		}
+	}
+
+	return result;
 }
\ No newline at end of file
@@ -1,14 +1,46 @@
 #include "PivotFinderSmallestFillIn.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include <map>
+#include <algorithm>
 #include <assert.h>
 
 template class PivotFinderSmallestFillIn<long double, Complex<long double>>;
 template class PivotFinderSmallestFillIn<MultiPrecision, Complex<MultiPrecision>>;
+template class PivotFinderSmallestFillIn<DoubleDouble, Complex<DoubleDouble>>;
+template class PivotFinderSmallestFillIn<QuadDouble, Complex<QuadDouble>>;
+template class PivotFinderSmallestFillIn<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
-int PivotFinderSmallestFillIn<Floating, ComplexFloating>::operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row) const
+int PivotFinderSmallestFillIn<Floating, ComplexFloating>::operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row, std::vector<int> const &candidateRows) const
 {
-	return row;
+	auto maximum = Floating(0);
+
+	for (auto i : candidateRows)
+		maximum = std::max(maximum, std::abs2(upper(i, row)));
+
+	// threshold pivoting, only candidates within a factor of ten of the biggest element are accepted
+	auto threshold = maximum*Floating(0.01);
+	auto result = row;
+	auto resultElementCount = upper.getColumnCount() + 1;
+
+	for (auto i : candidateRows)
+	{
+		auto value = std::abs2(upper(i, row));
+
+		if (value == Floating(0) || value < threshold)
+			continue;
+
+		auto elementCount = upper.getRowIterator(i, row).getNonZeroCount();
+
+		if (elementCount < resultElementCount)
+		{
+			result = i;
+			resultElementCount = elementCount;
+		}
+	}
+
+	return result;
 }
\ No newline at end of file
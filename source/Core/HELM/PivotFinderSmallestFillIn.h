@@ -7,6 +7,6 @@ class PivotFinderSmallestFillIn :
 	public IPivotFinder<Floating, ComplexFloating>
 {
 public:
-	virtual int operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row) const;
+	virtual int operator()(SparseMatrix<Floating, ComplexFloating> const &upper, int row, std::vector<int> const &candidateRows) const;
 };
 
@@ -0,0 +1,267 @@
+#include "PreconditionerIncompleteLU.h"
+#include "Complex.h"
+#include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include <assert.h>
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+using namespace std;
+
+template class PreconditionerIncompleteLU<long double, Complex<long double>>;
+template class PreconditionerIncompleteLU<MultiPrecision, Complex<MultiPrecision>>;
+template class PreconditionerIncompleteLU<DoubleDouble, Complex<DoubleDouble>>;
+template class PreconditionerIncompleteLU<QuadDouble, Complex<QuadDouble>>;
+template class PreconditionerIncompleteLU<double, Complex<double>>;
+
+template<class Floating, class ComplexFloating>
+PreconditionerIncompleteLU<Floating, ComplexFloating>::PreconditionerIncompleteLU(SparseMatrix<Floating, ComplexFloating> const &systemMatrix) :
+	_dimension(systemMatrix.getRowCount()),
+	_left(_dimension, _dimension),
+	_upper(_dimension, _dimension),
+	_inverseDiagonal(_dimension),
+	_y(_dimension)
+{
+	assert(systemMatrix.getRowCount() == systemMatrix.getColumnCount());
+	calculateDecomposition(systemMatrix, true, Floating(0), 0);
+}
+
+template<class Floating, class ComplexFloating>
+PreconditionerIncompleteLU<Floating, ComplexFloating>::PreconditionerIncompleteLU(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, Floating const &dropTolerance, int maximumFillIn) :
+	_dimension(systemMatrix.getRowCount()),
+	_left(_dimension, _dimension),
+	_upper(_dimension, _dimension),
+	_inverseDiagonal(_dimension),
+	_y(_dimension)
+{
+	assert(systemMatrix.getRowCount() == systemMatrix.getColumnCount());
+	assert(dropTolerance >= Floating(0));
+	assert(maximumFillIn >= 0);
+	calculateDecomposition(systemMatrix, false, dropTolerance, maximumFillIn);
+}
+
+// solves L*y = source and U*destination = y, the rows of one level depend only on the rows of the previous levels
+template<class Floating, class ComplexFloating>
+void PreconditionerIncompleteLU<Floating, ComplexFloating>::apply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const
+{
+	assert(destination.getCount() == _dimension);
+	assert(source.getCount() == _dimension);
+
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	for (auto levelIndex = 0; levelIndex < _forwardLevels.getLevelCount(); ++levelIndex)
+	{
+		auto const &level = _forwardLevels.getLevel(levelIndex);
+		int rowCount = level.size();
+
+		#pragma omp parallel if(_forwardLevels.isParallel(levelIndex))
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto j = 0; j < rowCount; ++j)
+			{
+				auto i = level[j];
+
+				if (i == 0)
+				{
+					_y.set(0, source(0));
+					continue;
+				}
+
+				auto rowSum = _left.multiplyRowWithEndColumn(i, _y, i - 1);
+				_y.set(i, source(i) - rowSum);
+			}
+		}
+	}
+
+	for (auto levelIndex = 0; levelIndex < _backwardLevels.getLevelCount(); ++levelIndex)
+	{
+		auto const &level = _backwardLevels.getLevel(levelIndex);
+		int rowCount = level.size();
+
+		#pragma omp parallel if(_backwardLevels.isParallel(levelIndex))
+		{
+			MultiPrecisionScope scope(bitPrecision);
+
+			#pragma omp for
+			for (auto j = 0; j < rowCount; ++j)
+			{
+				auto i = level[j];
+
+				if (i == _dimension - 1)
+				{
+					destination.set(i, _y(i)*_inverseDiagonal[i]);
+					continue;
+				}
+
+				auto rowSum = _upper.multiplyRowWithStartColumn(i, destination, i + 1);
+				destination.set(i, (_y(i) - rowSum)*_inverseDiagonal[i]);
+			}
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+int PreconditionerIncompleteLU<Floating, ComplexFloating>::getNonZeroCount() const
+{
+	return _left.getNonZeroCount() + _upper.getNonZeroCount();
+}
+
+template<class Floating, class ComplexFloating>
+int PreconditionerIncompleteLU<Floating, ComplexFloating>::getForwardLevelCount() const
+{
+	return _forwardLevels.getLevelCount();
+}
+
+template<class Floating, class ComplexFloating>
+int PreconditionerIncompleteLU<Floating, ComplexFloating>::getBackwardLevelCount() const
+{
+	return _backwardLevels.getLevelCount();
+}
+
+// the rows are eliminated one after another in a dense work row (IKJ variant), the fill-in of a row can itself require further eliminations,
+// therefore the columns left of the diagonal are processed in increasing order
+template<class Floating, class ComplexFloating>
+void PreconditionerIncompleteLU<Floating, ComplexFloating>::calculateDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, bool keepPattern, Floating const &dropTolerance, int maximumFillIn)
+{
+	vector<ComplexFloating> work(_dimension);
+	vector<int> marker(_dimension, -1);
+	vector<int> nonZeroColumns;
+	vector<vector<pair<int, ComplexFloating>>> upperRows(_dimension);
+	vector<pair<int, ComplexFloating>> lowerRow;
+	ComplexFloating const zero;
+
+	for (auto i = 0; i < _dimension; ++i)
+	{
+		priority_queue<int, vector<int>, greater<int>> pendingColumns;
+		Floating rowNormSquared(0);
+		auto lowerCount = 0;
+		auto upperCount = 0;
+		nonZeroColumns.clear();
+
+		for (auto iterator = systemMatrix.getRowIterator(i); iterator.isValid(); iterator.next())
+		{
+			auto column = iterator.getColumn();
+			work[column] = iterator.getValue();
+			marker[column] = i;
+			nonZeroColumns.push_back(column);
+			rowNormSquared += std::abs2(iterator.getValue());
+
+			if (column < i)
+			{
+				pendingColumns.push(column);
+				++lowerCount;
+			}
+			else if (column > i)
+				++upperCount;
+		}
+
+		auto rowNorm = sqrt(rowNormSquared);
+		auto threshold = dropTolerance*rowNorm;
+
+		while (!pendingColumns.empty())
+		{
+			auto k = pendingColumns.top();
+			pendingColumns.pop();
+			auto &factor = work[k];
+			factor *= _inverseDiagonal[k];
+
+			if (!keepPattern && std::abs(factor) < threshold)
+			{
+				factor = zero;
+				continue;
+			}
+
+			for (auto const &upperElement : upperRows[k])
+			{
+				auto column = upperElement.first;
+
+				if (marker[column] != i)
+				{
+					if (keepPattern)
+						continue;
+
+					marker[column] = i;
+					work[column] = zero;
+					nonZeroColumns.push_back(column);
+
+					if (column < i)
+						pendingColumns.push(column);
+				}
+
+				work[column].subtractProduct(factor, upperElement.second);
+			}
+		}
+
+		lowerRow.clear();
+		auto &upperRow = upperRows[i];
+		ComplexFloating diagonal;
+
+		for (auto column : nonZeroColumns)
+		{
+			ComplexFloating const &value = work[column];
+
+			if (column == i)
+				diagonal = value;
+			else if (value == zero || (!keepPattern && std::abs(value) < threshold))
+				continue;
+			else if (column < i)
+				lowerRow.push_back(make_pair(column, value));
+			else
+				upperRow.push_back(make_pair(column, value));
+		}
+
+		if (!keepPattern)
+		{
+			keepBiggestValues(lowerRow, lowerCount + maximumFillIn);
+			keepBiggestValues(upperRow, upperCount + maximumFillIn);
+		}
+
+		// a vanishing pivot is replaced with a small value relative to the row, like proposed by Saad for ILUT
+		if (diagonal == zero)
+		{
+			if (rowNorm == Floating(0))
+				throw invalid_argument("the system matrix contains an empty row");
+
+			diagonal = ComplexFloating((Floating(1e-4) + dropTolerance)*rowNorm);
+		}
+
+		_inverseDiagonal[i] = ComplexFloating(Floating(1))/diagonal;
+		sort(lowerRow.begin(), lowerRow.end(), [](pair<int, ComplexFloating> const &one, pair<int, ComplexFloating> const &two) { return one.first < two.first; });
+		sort(upperRow.begin(), upperRow.end(), [](pair<int, ComplexFloating> const &one, pair<int, ComplexFloating> const &two) { return one.first < two.first; });
+
+		for (auto const &element : lowerRow)
+			_left.set(i, element.first, element.second);
+
+		_upper.set(i, i, diagonal);
+
+		for (auto const &element : upperRow)
+			_upper.set(i, element.first, element.second);
+	}
+
+	_left.freeze();
+	_upper.freeze();
+	calculateLevels();
+}
+
+template<class Floating, class ComplexFloating>
+void PreconditionerIncompleteLU<Floating, ComplexFloating>::calculateLevels()
+{
+	_forwardLevels = LevelSchedule<Floating, ComplexFloating>::createForward(_left);
+	_backwardLevels = LevelSchedule<Floating, ComplexFloating>::createBackward(_upper);
+}
+
+template<class Floating, class ComplexFloating>
+void PreconditionerIncompleteLU<Floating, ComplexFloating>::keepBiggestValues(vector<pair<int, ComplexFloating>> &values, int count)
+{
+	if (static_cast<int>(values.size()) <= count)
+		return;
+
+	nth_element(values.begin(), values.begin() + count, values.end(), [](pair<int, ComplexFloating> const &one, pair<int, ComplexFloating> const &two) { return std::abs2(one.second) > std::abs2(two.second); });
+	values.resize(count);
+}
\ No newline at end of file
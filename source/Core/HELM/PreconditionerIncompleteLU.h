@@ -0,0 +1,37 @@
+#pragma once
+
+#include <vector>
+#include <utility>
+#include "IPreconditioner.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+#include "LevelSchedule.h"
+
+// incomplete LU decomposition, either restricted to the pattern of the system matrix (ILU(0)), or with the fill-in limited by a drop tolerance
+// relative to the norm of each row and a maximum count of additional elements per row of each factor (ILUT)
+template<class Floating, class ComplexFloating>
+class PreconditionerIncompleteLU : public IPreconditioner<Floating, ComplexFloating>
+{
+public:
+	PreconditionerIncompleteLU(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
+	PreconditionerIncompleteLU(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, Floating const &dropTolerance, int maximumFillIn);
+
+	virtual void apply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const;
+	int getNonZeroCount() const;
+	int getForwardLevelCount() const;
+	int getBackwardLevelCount() const;
+
+private:
+	void calculateDecomposition(SparseMatrix<Floating, ComplexFloating> const &systemMatrix, bool keepPattern, Floating const &dropTolerance, int maximumFillIn);
+	void calculateLevels();
+	static void keepBiggestValues(std::vector<std::pair<int, ComplexFloating>> &values, int count);
+
+private:
+	const int _dimension;
+	SparseMatrix<Floating, ComplexFloating> _left;
+	SparseMatrix<Floating, ComplexFloating> _upper;
+	std::vector<ComplexFloating> _inverseDiagonal;
+	LevelSchedule<Floating, ComplexFloating> _forwardLevels;
+	LevelSchedule<Floating, ComplexFloating> _backwardLevels;
+	mutable Vector<Floating, ComplexFloating> _y;
+};
\ No newline at end of file
@@ -0,0 +1,25 @@
+#include "PreconditionerJacobi.h"
+#include "Complex.h"
+#include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include <assert.h>
+
+template class PreconditionerJacobi<long double, Complex<long double>>;
+template class PreconditionerJacobi<MultiPrecision, Complex<MultiPrecision>>;
+template class PreconditionerJacobi<DoubleDouble, Complex<DoubleDouble>>;
+template class PreconditionerJacobi<QuadDouble, Complex<QuadDouble>>;
+template class PreconditionerJacobi<double, Complex<double>>;
+
+template<class Floating, class ComplexFloating>
+PreconditionerJacobi<Floating, ComplexFloating>::PreconditionerJacobi(SparseMatrix<Floating, ComplexFloating> const &systemMatrix) :
+	_inverseDiagonal(systemMatrix.getInverseMainDiagonal())
+{
+	assert(systemMatrix.getRowCount() == systemMatrix.getColumnCount());
+}
+
+template<class Floating, class ComplexFloating>
+void PreconditionerJacobi<Floating, ComplexFloating>::apply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const
+{
+	destination.pointwiseMultiply(_inverseDiagonal, source);
+}
\ No newline at end of file
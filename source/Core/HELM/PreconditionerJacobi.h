@@ -0,0 +1,17 @@
+#pragma once
+
+#include "IPreconditioner.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+template<class Floating, class ComplexFloating>
+class PreconditionerJacobi : public IPreconditioner<Floating, ComplexFloating>
+{
+public:
+	PreconditionerJacobi(SparseMatrix<Floating, ComplexFloating> const &systemMatrix);
+
+	virtual void apply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const;
+
+private:
+	Vector<Floating, ComplexFloating> _inverseDiagonal;
+};
\ No newline at end of file
@@ -0,0 +1,3 @@
+#pragma once
+
+typedef void (__stdcall * ProgressCallback)(int calculator, double progress, double relativePowerError);
\ No newline at end of file
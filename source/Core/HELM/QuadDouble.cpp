@@ -0,0 +1,442 @@
+#include "QuadDouble.h"
+#include "ErrorFreeTransformations.h"
+#include "ExtendedPrecisionOutput.h"
+#include <cmath>
+#include <limits>
+
+// the algorithms follow Hida, Li and Bailey, "Library for Double-Double and Quad-Double Arithmetic"
+
+static void renormalize(double &c0, double &c1, double &c2, double &c3)
+{
+	double s0, s1, s2 = 0, s3 = 0;
+
+	if (!(std::abs(c0) <= std::numeric_limits<double>::max()))
+		return;
+
+	s0 = quickTwoSum(c2, c3, c3);
+	s0 = quickTwoSum(c1, s0, c2);
+	c0 = quickTwoSum(c0, s0, c1);
+	s0 = c0;
+	s1 = c1;
+
+	if (s1 != 0)
+	{
+		s1 = quickTwoSum(s1, c2, s2);
+
+		if (s2 != 0)
+			s2 = quickTwoSum(s2, c3, s3);
+		else
+			s1 = quickTwoSum(s1, c3, s2);
+	}
+	else
+	{
+		s0 = quickTwoSum(s0, c2, s1);
+
+		if (s1 != 0)
+			s1 = quickTwoSum(s1, c3, s2);
+		else
+			s0 = quickTwoSum(s0, c3, s1);
+	}
+
+	c0 = s0;
+	c1 = s1;
+	c2 = s2;
+	c3 = s3;
+}
+
+static void renormalize(double &c0, double &c1, double &c2, double &c3, double &c4)
+{
+	double s0, s1, s2 = 0, s3 = 0;
+
+	if (!(std::abs(c0) <= std::numeric_limits<double>::max()))
+		return;
+
+	s0 = quickTwoSum(c3, c4, c4);
+	s0 = quickTwoSum(c2, s0, c3);
+	s0 = quickTwoSum(c1, s0, c2);
+	c0 = quickTwoSum(c0, s0, c1);
+	s0 = quickTwoSum(c0, c1, s1);
+
+	if (s1 != 0)
+	{
+		s1 = quickTwoSum(s1, c2, s2);
+
+		if (s2 != 0)
+		{
+			s2 = quickTwoSum(s2, c3, s3);
+
+			if (s3 != 0)
+				s3 += c4;
+			else
+				s2 = quickTwoSum(s2, c4, s3);
+		}
+		else
+		{
+			s1 = quickTwoSum(s1, c3, s2);
+
+			if (s2 != 0)
+				s2 = quickTwoSum(s2, c4, s3);
+			else
+				s1 = quickTwoSum(s1, c4, s2);
+		}
+	}
+	else
+	{
+		s0 = quickTwoSum(s0, c2, s1);
+
+		if (s1 != 0)
+		{
+			s1 = quickTwoSum(s1, c3, s2);
+
+			if (s2 != 0)
+				s2 = quickTwoSum(s2, c4, s3);
+			else
+				s1 = quickTwoSum(s1, c4, s2);
+		}
+		else
+		{
+			s0 = quickTwoSum(s0, c3, s1);
+
+			if (s1 != 0)
+				s1 = quickTwoSum(s1, c4, s2);
+			else
+				s0 = quickTwoSum(s0, c4, s1);
+		}
+	}
+
+	c0 = s0;
+	c1 = s1;
+	c2 = s2;
+	c3 = s3;
+}
+
+static double quickThreeAccumulate(double &a, double &b, double c)
+{
+	double s;
+	s = twoSum(b, c, b);
+	s = twoSum(a, s, a);
+	auto aIsZero = a == 0;
+	auto bIsZero = b == 0;
+
+	if (!aIsZero && !bIsZero)
+		return s;
+
+	if (bIsZero)
+	{
+		b = a;
+		a = s;
+	}
+	else
+		a = s;
+
+	return 0;
+}
+
+QuadDouble::QuadDouble()
+{
+	_components[0] = 0;
+	_components[1] = 0;
+	_components[2] = 0;
+	_components[3] = 0;
+}
+
+QuadDouble::QuadDouble(QuadDouble const& rhs)
+{
+	for (auto i = 0; i < 4; ++i)
+		_components[i] = rhs.getComponent(i);
+}
+
+QuadDouble::QuadDouble(double first, double second, double third, double fourth)
+{
+	renormalize(first, second, third, fourth);
+	_components[0] = first;
+	_components[1] = second;
+	_components[2] = third;
+	_components[3] = fourth;
+}
+
+QuadDouble::QuadDouble(float value)
+{
+	_components[0] = value;
+	_components[1] = 0;
+	_components[2] = 0;
+	_components[3] = 0;
+}
+
+QuadDouble::QuadDouble(double value)
+{
+	_components[0] = value;
+	_components[1] = 0;
+	_components[2] = 0;
+	_components[3] = 0;
+}
+
+QuadDouble::QuadDouble(long double value)
+{
+	auto first = static_cast<double>(value);
+	_components[0] = first;
+	_components[1] = static_cast<double>(value - static_cast<long double>(first));
+	_components[2] = 0;
+	_components[3] = 0;
+}
+
+QuadDouble::QuadDouble(int value)
+{
+	_components[0] = value;
+	_components[1] = 0;
+	_components[2] = 0;
+	_components[3] = 0;
+}
+
+QuadDouble::operator double() const
+{
+	return _components[0] + _components[1];
+}
+
+QuadDouble::operator long double() const
+{
+	return static_cast<long double>(_components[0]) + static_cast<long double>(_components[1]) + static_cast<long double>(_components[2]);
+}
+
+QuadDouble::operator int() const
+{
+	return static_cast<int>(_components[0] + _components[1]);
+}
+
+QuadDouble& QuadDouble::operator=(const QuadDouble &rhs)
+{
+	for (auto i = 0; i < 4; ++i)
+		_components[i] = rhs.getComponent(i);
+
+	return *this;
+}
+
+QuadDouble& QuadDouble::operator+=(const QuadDouble &rhs)
+{
+	*this = *this + rhs;
+	return *this;
+}
+
+QuadDouble& QuadDouble::operator-=(const QuadDouble &rhs)
+{
+	*this = *this - rhs;
+	return *this;
+}
+
+QuadDouble& QuadDouble::operator*=(const QuadDouble &rhs)
+{
+	*this = *this * rhs;
+	return *this;
+}
+
+QuadDouble& QuadDouble::operator/=(const QuadDouble &rhs)
+{
+	*this = *this / rhs;
+	return *this;
+}
+
+double QuadDouble::getComponent(int index) const
+{
+	return _components[index];
+}
+
+const QuadDouble QuadDouble::operator+() const
+{
+	return *this;
+}
+
+const QuadDouble QuadDouble::operator-() const
+{
+	return QuadDouble(-_components[0], -_components[1], -_components[2], -_components[3]);
+}
+
+// merges the components of both summands ordered by their magnitude, like the IEEE conforming addition of the QD library
+const QuadDouble operator+(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	int i = 0, j = 0, k = 0;
+	double u, v, t;
+	double result[4] = { 0, 0, 0, 0 };
+
+	if (std::abs(lhs.getComponent(i)) > std::abs(rhs.getComponent(j)))
+		u = lhs.getComponent(i++);
+	else
+		u = rhs.getComponent(j++);
+
+	if (std::abs(lhs.getComponent(i)) > std::abs(rhs.getComponent(j)))
+		v = lhs.getComponent(i++);
+	else
+		v = rhs.getComponent(j++);
+
+	u = quickTwoSum(u, v, v);
+
+	while (k < 4)
+	{
+		if (i >= 4 && j >= 4)
+		{
+			result[k] = u;
+
+			if (k < 3)
+				result[++k] = v;
+
+			break;
+		}
+
+		if (i >= 4)
+			t = rhs.getComponent(j++);
+		else if (j >= 4)
+			t = lhs.getComponent(i++);
+		else if (std::abs(lhs.getComponent(i)) > std::abs(rhs.getComponent(j)))
+			t = lhs.getComponent(i++);
+		else
+			t = rhs.getComponent(j++);
+
+		auto s = quickThreeAccumulate(u, v, t);
+
+		if (s != 0)
+			result[k++] = s;
+	}
+
+	for (k = i; k < 4; ++k)
+		result[3] += lhs.getComponent(k);
+
+	for (k = j; k < 4; ++k)
+		result[3] += rhs.getComponent(k);
+
+	return QuadDouble(result[0], result[1], result[2], result[3]);
+}
+
+const QuadDouble operator-(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	return lhs + (-rhs);
+}
+
+// the terms of the order eps^4 and smaller are neglected
+const QuadDouble operator*(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	double p0, p1, p2, p3, p4, p5;
+	double q0, q1, q2, q3, q4, q5;
+	double t0, t1;
+	double s0, s1, s2;
+
+	p0 = twoProduct(lhs.getComponent(0), rhs.getComponent(0), q0);
+	p1 = twoProduct(lhs.getComponent(0), rhs.getComponent(1), q1);
+	p2 = twoProduct(lhs.getComponent(1), rhs.getComponent(0), q2);
+	p3 = twoProduct(lhs.getComponent(0), rhs.getComponent(2), q3);
+	p4 = twoProduct(lhs.getComponent(1), rhs.getComponent(1), q4);
+	p5 = twoProduct(lhs.getComponent(2), rhs.getComponent(0), q5);
+
+	threeSum(p1, p2, q0);
+	threeSum(p2, q1, q2);
+	threeSum(p3, p4, p5);
+
+	s0 = twoSum(p2, p3, t0);
+	s1 = twoSum(q1, p4, t1);
+	s2 = q2 + p5;
+	s1 = twoSum(s1, t0, t0);
+	s2 += t0 + t1;
+
+	s1 += lhs.getComponent(0)*rhs.getComponent(3) + lhs.getComponent(1)*rhs.getComponent(2) + lhs.getComponent(2)*rhs.getComponent(1) + lhs.getComponent(3)*rhs.getComponent(0) + q0 + q3 + q4 + q5;
+	renormalize(p0, p1, s0, s1, s2);
+	return QuadDouble(p0, p1, s0, s1);
+}
+
+// long division with four partial quotients, each of them calculated with double precision
+const QuadDouble operator/(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	double quotients[4];
+	auto remainder = lhs;
+
+	for (auto i = 0; i < 4; ++i)
+	{
+		quotients[i] = remainder.getComponent(0)/rhs.getComponent(0);
+
+		if (i < 3)
+			remainder -= rhs*QuadDouble(quotients[i]);
+	}
+
+	return QuadDouble(quotients[0], quotients[1], quotients[2], quotients[3]);
+}
+
+bool operator<(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	for (auto i = 0; i < 4; ++i)
+		if (lhs.getComponent(i) != rhs.getComponent(i))
+			return lhs.getComponent(i) < rhs.getComponent(i);
+
+	return false;
+}
+
+bool operator>(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	return rhs < lhs;
+}
+
+bool operator>=(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	return !(lhs < rhs);
+}
+
+bool operator<=(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	return !(rhs < lhs);
+}
+
+bool operator==(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	for (auto i = 0; i < 4; ++i)
+		if (lhs.getComponent(i) != rhs.getComponent(i))
+			return false;
+
+	return true;
+}
+
+bool operator!=(const QuadDouble &lhs, const QuadDouble &rhs)
+{
+	return !(lhs == rhs);
+}
+
+std::ostream& operator<<(std::ostream &stream, QuadDouble const& value)
+{
+	return writeExtendedPrecision(stream, value, value.getComponent(0), 62);
+}
+
+QuadDouble std::abs(QuadDouble const& value)
+{
+	return value.getComponent(0) < 0 ? -value : value;
+}
+
+// Newton iteration for the inverse square root, each step doubles the number of correct digits
+QuadDouble std::sqrt(QuadDouble const& value)
+{
+	if (value.getComponent(0) <= 0)
+		return QuadDouble(sqrt(value.getComponent(0)));
+
+	QuadDouble const half(0.5);
+	QuadDouble const halfValue = value*half;
+	QuadDouble inverseRoot(1.0/sqrt(value.getComponent(0)));
+
+	for (auto i = 0; i < 3; ++i)
+		inverseRoot += (half - halfValue*inverseRoot*inverseRoot)*inverseRoot;
+
+	return inverseRoot*value;
+}
+
+QuadDouble std::log(QuadDouble const& value)
+{
+	return QuadDouble(log(static_cast<double>(value)));
+}
+
+QuadDouble std::ceil(QuadDouble const& value)
+{
+	double components[4] = { 0, 0, 0, 0 };
+
+	for (auto i = 0; i < 4; ++i)
+	{
+		components[i] = ceil(value.getComponent(i));
+
+		if (components[i] != value.getComponent(i))
+			break;
+	}
+
+	return QuadDouble(components[0], components[1], components[2], components[3]);
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <ostream>
+
+// unevaluated sum of four doubles, which gives about 212 bits of mantissa with hardware floating point operations only
+class QuadDouble
+{
+public:
+	QuadDouble();
+	QuadDouble(QuadDouble const& rhs);
+	QuadDouble(double first, double second, double third, double fourth);
+	explicit QuadDouble(float value);
+	explicit QuadDouble(double value);
+	explicit QuadDouble(long double value);
+	explicit QuadDouble(int value);
+
+	operator double() const;
+	operator long double() const;
+	operator int() const;
+	QuadDouble& operator=(const QuadDouble &rhs);
+	QuadDouble& operator+=(const QuadDouble &rhs);
+	QuadDouble& operator-=(const QuadDouble &rhs);
+	QuadDouble& operator*=(const QuadDouble &rhs);
+	QuadDouble& operator/=(const QuadDouble &rhs);
+	double getComponent(int index) const;
+	const QuadDouble operator+() const;
+	const QuadDouble operator-() const;
+
+private:
+	double _components[4];
+};
+
+const QuadDouble operator+(const QuadDouble &lhs, const QuadDouble &rhs);
+const QuadDouble operator-(const QuadDouble &lhs, const QuadDouble &rhs);
+const QuadDouble operator*(const QuadDouble &lhs, const QuadDouble &rhs);
+const QuadDouble operator/(const QuadDouble &lhs, const QuadDouble &rhs);
+bool operator<(const QuadDouble &lhs, const QuadDouble &rhs);
+bool operator>(const QuadDouble &lhs, const QuadDouble &rhs);
+bool operator>=(const QuadDouble &lhs, const QuadDouble &rhs);
+bool operator<=(const QuadDouble &lhs, const QuadDouble &rhs);
+bool operator==(const QuadDouble &lhs, const QuadDouble &rhs);
+bool operator!=(const QuadDouble &lhs, const QuadDouble &rhs);
+std::ostream& operator<<(std::ostream &stream, QuadDouble const& value);
+
+namespace std
+{
+	QuadDouble abs(QuadDouble const& value);
+	QuadDouble sqrt(QuadDouble const& value);
+	// only as accurate as the logarithm of a double, like the one of MultiPrecision
+	QuadDouble log(QuadDouble const& value);
+	QuadDouble ceil(QuadDouble const& value);
+}
\ No newline at end of file
@@ -0,0 +1,223 @@
+#include "RelaxedConvolution.h"
+#include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include "Complex.h"
+#include "ComplexDoubleKernels.h"
+#include <assert.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <omp.h>
+
+using namespace std;
+
+template class RelaxedConvolution< Complex<long double>, long double >;
+template class RelaxedConvolution< Complex<MultiPrecision>, MultiPrecision >;
+template class RelaxedConvolution< Complex<DoubleDouble>, DoubleDouble >;
+template class RelaxedConvolution< Complex<QuadDouble>, QuadDouble >;
+template class RelaxedConvolution< Complex<double>, double >;
+
+template<typename ComplexType, typename RealType>
+RelaxedConvolution<ComplexType, RealType>::RelaxedConvolution(int maximumNumberOfCoefficients, int seriesCount) :
+	_maximumNumberOfCoefficients(maximumNumberOfCoefficients),
+	_sums(maximumNumberOfCoefficients*seriesCount),
+	_scratches(max(omp_get_max_threads(), omp_get_num_procs()))
+{
+	assert(maximumNumberOfCoefficients > 0);
+	assert(seriesCount >= 0);
+}
+
+template<typename ComplexType, typename RealType>
+ComplexType const& RelaxedConvolution<ComplexType, RealType>::calculateNextCoefficient(int series, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance)
+{
+	assert(step >= 0 && step < _maximumNumberOfCoefficients);
+	auto sums = &_sums[series*_maximumNumberOfCoefficients];
+
+	if (step == 0)
+		return sums[0];
+
+	sums[step].addProduct(first[step*firstDistance], second[0]);
+
+	// the squares with the side length 2^k are complete at the steps (p + 1)*2^k, the first one covers first[2^k ... 2^(k + 1) - 1] and second[p*2^k ... (p + 1)*2^k - 1],
+	// the second one the mirrored area, as long as this is not the same one
+	for (auto length = 1; 2*length <= step && step % length == 0; length *= 2)
+	{
+		auto p = step/length - 1;
+		addSquare(sums, step, first + length*firstDistance, firstDistance, second + p*length*secondDistance, secondDistance, length);
+
+		if (p > 1)
+			addSquare(sums, step, first + p*length*firstDistance, firstDistance, second + length*secondDistance, secondDistance, length);
+	}
+
+	return sums[step];
+}
+
+template<typename ComplexType, typename RealType>
+void RelaxedConvolution<ComplexType, RealType>::addSquare(ComplexType *sums, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length)
+{
+	// the products of a square, which reach beyond the maximum number of coefficients, are skipped, which is only possible with the direct multiplication
+	auto scratch = length >= _karatsubaThreshold && step + 2*length - 1 <= _maximumNumberOfCoefficients ? getScratch() : 0;
+	double scalingExponent;
+
+	if (scratch != 0 && calculateScalingExponent(first, firstDistance, second, secondDistance, length, scalingExponent))
+		addSquareKaratsuba(sums, step, first, firstDistance, second, secondDistance, length, scalingExponent, *scratch);
+	else
+		addSquareDirect(sums, step, first, firstDistance, second, secondDistance, length);
+}
+
+template<typename ComplexType, typename RealType>
+void RelaxedConvolution<ComplexType, RealType>::addSquareDirect(ComplexType *sums, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length) const
+{
+	for (auto i = 0; i < length; ++i)
+	{
+		auto count = min(length, _maximumNumberOfCoefficients - step - i);
+		addProducts(sums + step + i, first[i*firstDistance], second, secondDistance, count);
+	}
+}
+
+// the subtractions of Karatsuba lose the small products next to the big ones, therefore the coefficients are scaled to similar magnitudes,
+// which causes only relative rounding errors
+template<typename ComplexType, typename RealType>
+void RelaxedConvolution<ComplexType, RealType>::addSquareKaratsuba(ComplexType *sums, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length, double scalingExponent, vector<ComplexType> &scratch) const
+{
+	if (scratch.size() < static_cast<size_t>(8*length))
+		scratch.resize(8*length);
+
+	auto scaledFirst = &scratch[0];
+	auto scaledSecond = &scratch[length];
+	auto product = &scratch[2*length];
+	auto karatsubaScratch = &scratch[4*length];
+	ComplexType const scaling(RealType(exp2(scalingExponent)));
+	ComplexType const inverseScaling(RealType(1)/RealType(exp2(scalingExponent)));
+	ComplexType power(RealType(1));
+
+	for (auto i = 0; i < length; ++i)
+	{
+		scaledFirst[i].assignProduct(first[i*firstDistance], power);
+		scaledSecond[i].assignProduct(second[i*secondDistance], power);
+		power *= scaling;
+	}
+
+	multiplyKaratsuba(scaledFirst, scaledSecond, length, product, karatsubaScratch);
+	auto count = min(2*length - 1, _maximumNumberOfCoefficients - step);
+	power = ComplexType(RealType(1));
+
+	for (auto i = 0; i < count; ++i)
+	{
+		sums[step + i].addProduct(product[i], power);
+		power *= inverseScaling;
+	}
+}
+
+// the scratch of one thread is only used by this thread, therefore the buses can still be calculated in parallel
+template<typename ComplexType, typename RealType>
+vector<ComplexType>* RelaxedConvolution<ComplexType, RealType>::getScratch()
+{
+	auto thread = omp_get_thread_num();
+
+	if (thread >= static_cast<int>(_scratches.size()))
+		return 0;
+
+	return &_scratches[thread];
+}
+
+// the result needs space for 2*length - 1 values, the scratch for 4*length values
+template<typename ComplexType, typename RealType>
+void RelaxedConvolution<ComplexType, RealType>::multiplyKaratsuba(ComplexType const *first, ComplexType const *second, int length, ComplexType *result, ComplexType *scratch)
+{
+	if (length < _karatsubaThreshold)
+	{
+		for (auto i = 0; i < 2*length - 1; ++i)
+			result[i] = ComplexType();
+
+		for (auto i = 0; i < length; ++i)
+			addProducts(result + i, first[i], second, 1, length);
+
+		return;
+	}
+
+	auto half = length/2;
+	auto firstSum = scratch;
+	auto secondSum = scratch + half;
+	auto middle = scratch + length;
+	auto nextScratch = scratch + 2*length;
+
+	multiplyKaratsuba(first, second, half, result, nextScratch);
+	multiplyKaratsuba(first + half, second + half, half, result + length, nextScratch);
+	result[length - 1] = ComplexType();
+
+	for (auto i = 0; i < half; ++i)
+	{
+		firstSum[i] = first[i];
+		firstSum[i] += first[half + i];
+		secondSum[i] = second[i];
+		secondSum[i] += second[half + i];
+	}
+
+	multiplyKaratsuba(firstSum, secondSum, half, middle, nextScratch);
+
+	for (auto i = 0; i < length - 1; ++i)
+	{
+		middle[i] -= result[i];
+		middle[i] -= result[length + i];
+	}
+
+	for (auto i = 0; i < length - 1; ++i)
+		result[half + i] += middle[i];
+}
+
+// adds factor*x[j*xDistance] to result[j] for j from 0 to count - 1
+template<typename ComplexType, typename RealType>
+void RelaxedConvolution<ComplexType, RealType>::addProducts(ComplexType *result, ComplexType const &factor, ComplexType const *x, int xDistance, int count)
+{
+	for (auto j = 0; j < count; ++j)
+		result[j].addProduct(factor, x[j*xDistance]);
+}
+
+template<>
+void RelaxedConvolution<Complex<double>, double>::addProducts(Complex<double> *result, Complex<double> const &factor, Complex<double> const *x, int xDistance, int count)
+{
+	addComplexProducts(result, factor, x, xDistance, count);
+}
+
+// the magnitudes decrease respectively increase roughly geometrically, the rate is estimated from the biggest values of both halfs of the squares
+template<typename ComplexType, typename RealType>
+bool RelaxedConvolution<ComplexType, RealType>::calculateScalingExponent(ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length, double &scalingExponent)
+{
+	auto const half = length/2;
+	double maxima[4];
+	fill(maxima, maxima + 4, -numeric_limits<double>::infinity());
+
+	for (auto i = 0; i < length; ++i)
+	{
+		double exponent;
+
+		if (calculateMagnitudeExponent(first[i*firstDistance], exponent))
+			maxima[i/half] = max(maxima[i/half], exponent);
+
+		if (calculateMagnitudeExponent(second[i*secondDistance], exponent))
+			maxima[2 + i/half] = max(maxima[2 + i/half], exponent);
+	}
+
+	for (auto i = 0; i < 4; ++i)
+		if (maxima[i] == -numeric_limits<double>::infinity())
+			return false;
+
+	auto slope = (maxima[1] - maxima[0] + maxima[3] - maxima[2])/(2*half);
+	scalingExponent = (-1)*slope;
+	// the powers of the scaling have to stay in the range of double, which has the smallest exponents of all the supported types
+	return std::abs(scalingExponent)*(2*length - 2) < 900;
+}
+
+template<typename ComplexType, typename RealType>
+bool RelaxedConvolution<ComplexType, RealType>::calculateMagnitudeExponent(ComplexType const &value, double &exponent)
+{
+	auto magnitude = max(abs(static_cast<double>(value.real())), abs(static_cast<double>(value.imag())));
+
+	if (!(magnitude > 0 && magnitude <= numeric_limits<double>::max()))
+		return false;
+
+	exponent = log2(magnitude);
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+
+template<typename T> class Complex;
+
+// relaxed multiplication of van der Hoeven for two series, whose coefficients become known one after another:
+// the products of the coefficients are grouped into squares, which are added to the sums of the future steps as soon as all their factors are known,
+// and the long squares are multiplied with the method of Karatsuba, which results in a subquadratic total cost
+template<typename ComplexType, typename RealType>
+class RelaxedConvolution
+{
+public:
+	RelaxedConvolution(int maximumNumberOfCoefficients, int seriesCount);
+
+	// returns the sum of first[i]*second[step - i] for i from 1 to step, therefore the second series is only necessary up to step - 1,
+	// and the steps of each series have to be calculated one after another, starting with zero
+	ComplexType const& calculateNextCoefficient(int series, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance);
+
+private:
+	void addSquare(ComplexType *sums, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length);
+	void addSquareDirect(ComplexType *sums, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length) const;
+	void addSquareKaratsuba(ComplexType *sums, int step, ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length, double scalingExponent, std::vector<ComplexType> &scratch) const;
+	std::vector<ComplexType>* getScratch();
+	static void multiplyKaratsuba(ComplexType const *first, ComplexType const *second, int length, ComplexType *result, ComplexType *scratch);
+	static void addProducts(ComplexType *result, ComplexType const &factor, ComplexType const *x, int xDistance, int count);
+	static bool calculateScalingExponent(ComplexType const *first, int firstDistance, ComplexType const *second, int secondDistance, int length, double &scalingExponent);
+	static bool calculateMagnitudeExponent(ComplexType const &value, double &exponent);
+
+private:
+	static const int _karatsubaThreshold = 16;
+	const int _maximumNumberOfCoefficients;
+	std::vector<ComplexType> _sums;
+	std::vector< std::vector<ComplexType> > _scratches;
+
+private:
+	RelaxedConvolution(RelaxedConvolution const &rhs);
+	void operator=(RelaxedConvolution const &rhs);
+};
+
+// uses the vectorized kernel for double
+template<>
+void RelaxedConvolution<Complex<double>, double>::addProducts(Complex<double> *result, Complex<double> const &factor, Complex<double> const *x, int xDistance, int count);
\ No newline at end of file
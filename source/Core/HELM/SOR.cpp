@@ -1,11 +1,16 @@
 #include "SOR.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "NumericalTraits.h"
 #include <assert.h>
 
 template class SOR<long double, Complex<long double>>;
 template class SOR<MultiPrecision, Complex<MultiPrecision>>;
+template class SOR<DoubleDouble, Complex<DoubleDouble>>;
+template class SOR<QuadDouble, Complex<QuadDouble>>;
+template class SOR<double, Complex<double>>;
 
 template<class Floating, class ComplexFloating>
 SOR<Floating, ComplexFloating>::SOR(const SparseMatrix<Floating, ComplexFloating> &systemMatrix, Floating epsilon, Floating omega, int maximumIterations) : 
@@ -14,7 +19,10 @@ SOR<Floating, ComplexFloating>::SOR(const SparseMatrix<Floating, ComplexFloating
 	_omega(omega),
 	_maximumIterations(maximumIterations),
 	_systemMatrix(systemMatrix),
-	_preconditioner(_dimension, _dimension)
+	_preconditioner(_dimension, _dimension),
+	_bPreconditioned(_dimension),
+	_residual(_dimension),
+	_bCurrent(_dimension)
 {
 	assert(systemMatrix.getColumnCount() == systemMatrix.getRowCount());
 	assert(omega > Floating(0) && omega < Floating(2));
@@ -25,22 +33,51 @@ SOR<Floating, ComplexFloating>::SOR(const SparseMatrix<Floating, ComplexFloating
 
 	for (auto i = 0; i < _dimension; ++i)
 		_preconditioner.set(i, i, diagonal(i));	
+
+	_systemMatrix.freeze();
+	_preconditioner.freeze();
 }
 
 template<class Floating, class ComplexFloating>
 Vector<Floating, ComplexFloating> SOR<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b) const
 {
-	return solve(Vector<Floating, ComplexFloating>(_dimension), b);
+	Vector<Floating, ComplexFloating> x(_dimension);
+	iterate(x, b);
+	return x;
+}
+
+template<class Floating, class ComplexFloating>
+void SOR<Floating, ComplexFloating>::solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const
+{
+	x.setToZero();
+	iterate(x, b);
+}
+
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> SOR<Floating, ComplexFloating>::solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history) const
+{
+	auto x = history.calculateInitialGuess(b);
+	iterate(x, b);
+	return x;
 }
 
 template<class Floating, class ComplexFloating>
-Vector<Floating, ComplexFloating> SOR<Floating, ComplexFloating>::solve(Vector<Floating, ComplexFloating> x, const Vector<Floating, ComplexFloating> &b) const
+void SOR<Floating, ComplexFloating>::solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, Vector<Floating, ComplexFloating> &x) const
 {
-	auto bPreconditioned = Vector<Floating, ComplexFloating>(b.getCount());
+	history.calculateInitialGuess(b, x);
+	iterate(x, b);
+}
+
+
+// improves the initial guess in x
+template<class Floating, class ComplexFloating>
+void SOR<Floating, ComplexFloating>::iterate(Vector<Floating, ComplexFloating> &x, const Vector<Floating, ComplexFloating> &b) const
+{
+	auto &bPreconditioned = _bPreconditioned;
+	auto &residual = _residual;
+	auto &bCurrent = _bCurrent;
 	_preconditioner.multiply(bPreconditioned, b);
-	auto residual = Vector<Floating, ComplexFloating>(_dimension);
 	auto epsilonSquared = _epsilon*_epsilon;
-	auto bCurrent = Vector<Floating, ComplexFloating>(_dimension);
 	auto iterations = 0;
 	auto bSquaredNorm = bPreconditioned.squaredNorm();
 	auto relativeError = epsilonSquared + Floating(1);
@@ -77,6 +114,4 @@ Vector<Floating, ComplexFloating> SOR<Floating, ComplexFloating>::solve(Vector<F
 		if (!x.isFinite())
 			throw overflow_error("SOR did not converge to a proper value");
 	} while(relativeError > epsilonSquared && iterations < _maximumIterations);	
-
-	return x;
 }
\ No newline at end of file
@@ -10,7 +10,12 @@ public:
 	SOR(const SparseMatrix<Floating, ComplexFloating> &systemMatrix, Floating epsilon, Floating omega, int maximumIterations);
 
 	virtual Vector<Floating, ComplexFloating> solve(const Vector<Floating, ComplexFloating> &b) const;
-	virtual Vector<Floating, ComplexFloating> solve(Vector<Floating, ComplexFloating> x, const Vector<Floating, ComplexFloating> &b) const;
+	virtual void solve(const Vector<Floating, ComplexFloating> &b, Vector<Floating, ComplexFloating> &x) const;
+	virtual Vector<Floating, ComplexFloating> solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history) const;
+	virtual void solveWithHistory(const Vector<Floating, ComplexFloating> &b, SolutionHistory<Floating, ComplexFloating> const &history, Vector<Floating, ComplexFloating> &x) const;
+
+private:
+	void iterate(Vector<Floating, ComplexFloating> &x, const Vector<Floating, ComplexFloating> &b) const;
 
 private:	
 	const Floating _epsilon;
@@ -19,5 +24,8 @@ private:
 	const int _maximumIterations;
 	SparseMatrix<Floating, ComplexFloating> _systemMatrix;
 	SparseMatrix<Floating, ComplexFloating> _preconditioner;
+	mutable Vector<Floating, ComplexFloating> _bPreconditioned;
+	mutable Vector<Floating, ComplexFloating> _residual;
+	mutable Vector<Floating, ComplexFloating> _bCurrent;
 };
 
@@ -0,0 +1,140 @@
+#include "SolutionHistory.h"
+#include "Complex.h"
+#include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+#include <algorithm>
+#include <assert.h>
+
+template class SolutionHistory<long double, Complex<long double>>;
+template class SolutionHistory<MultiPrecision, Complex<MultiPrecision>>;
+template class SolutionHistory<DoubleDouble, Complex<DoubleDouble>>;
+template class SolutionHistory<QuadDouble, Complex<QuadDouble>>;
+template class SolutionHistory<double, Complex<double>>;
+
+template<class Floating, class ComplexFloating>
+SolutionHistory<Floating, ComplexFloating>::SolutionHistory(int dimension, int maximumLength) :
+	_dimension(dimension),
+	_maximumLength(maximumLength),
+	_rightHandSides(maximumLength, Vector<Floating, ComplexFloating>(dimension)),
+	_solutions(maximumLength, Vector<Floating, ComplexFloating>(dimension)),
+	_length(0),
+	_oldest(0),
+	_rightHandSide(dimension),
+	_solution(dimension),
+	_remainder(dimension),
+	_weights(maximumLength)
+{
+	assert(dimension > 0);
+	assert(maximumLength > 0);
+}
+
+// the right hand side is orthogonalized twice against the stored ones, and the solution is transformed the same way,
+// so that the stored solutions still solve the system for the stored right hand sides, once the history is full the oldest pair is overwritten,
+// the vectors for all pairs are allocated in advance, therefore adding a pair never allocates
+template<class Floating, class ComplexFloating>
+void SolutionHistory<Floating, ComplexFloating>::add(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> const &x)
+{
+	assert(b.getCount() == _dimension);
+	assert(x.getCount() == _dimension);
+	auto &rightHandSide = _rightHandSide;
+	auto &solution = _solution;
+	rightHandSide = b;
+	solution = x;
+	auto norm = std::sqrt(std::real(rightHandSide.conjugateDot(rightHandSide)));
+
+	// the products are reduced in the workspace, whose temporary values are allocated only once, instead of in each stored vector
+	for (auto pass = 0; pass < 2; ++pass)
+		for (auto i = 0; i < _length; ++i)
+		{
+			auto weight = std::conj(rightHandSide.conjugateDot(_rightHandSides[i]))*ComplexFloating(Floating(-1));
+			rightHandSide.weightedSum(rightHandSide, weight, _rightHandSides[i]);
+			solution.weightedSum(solution, weight, _solutions[i]);
+		}
+
+	auto remainingNorm = std::sqrt(std::real(rightHandSide.conjugateDot(rightHandSide)));
+
+	// an almost linear dependent right hand side would only amplify the errors of its solution
+	if (!(remainingNorm > norm*Floating(1e-10)))
+		return;
+
+	if (_length < _maximumLength)
+	{
+		_oldest = _length;
+		++_length;
+	}
+
+	auto scaling = ComplexFloating(Floating(1)/remainingNorm);
+	auto &storedRightHandSide = _rightHandSides[_oldest];
+	auto &storedSolution = _solutions[_oldest];
+	storedRightHandSide.setToZero();
+	storedSolution.setToZero();
+	storedRightHandSide.weightedSum(storedRightHandSide, scaling, rightHandSide);
+	storedSolution.weightedSum(storedSolution, scaling, solution);
+	_oldest = (_oldest + 1)%_maximumLength;
+}
+
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> SolutionHistory<Floating, ComplexFloating>::calculateInitialGuess(Vector<Floating, ComplexFloating> const &b) const
+{
+	Vector<Floating, ComplexFloating> result(_dimension);
+	calculateInitialGuess(b, result);
+	return result;
+}
+
+template<class Floating, class ComplexFloating>
+void SolutionHistory<Floating, ComplexFloating>::calculateInitialGuess(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> &x) const
+{
+	calculatePartialSolution(b, _remainder, x);
+}
+
+// splits the right hand side into the part within the previous right hand sides, which is solved by the partial solution, and the remainder,
+// this is called for every iteration of the solver, therefore all stored vectors are processed within one pass
+template<class Floating, class ComplexFloating>
+void SolutionHistory<Floating, ComplexFloating>::calculatePartialSolution(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> &remainder, Vector<Floating, ComplexFloating> &partialSolution) const
+{
+	assert(b.getCount() == _dimension);
+	assert(remainder.getCount() == _dimension);
+	assert(partialSolution.getCount() == _dimension);
+	auto length = getLength();
+	auto &weights = _weights;
+	std::fill(weights.begin(), weights.end(), ComplexFloating(Floating(0)));
+
+	for (auto row = 0; row < _dimension; ++row)
+	{
+		ComplexFloating const &value = b(row);
+
+		for (auto i = 0; i < length; ++i)
+			weights[i] += std::conj(_rightHandSides[i](row))*value;
+	}
+
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto row = 0; row < _dimension; ++row)
+		{
+			auto remainderValue = b(row);
+			auto partialSolutionValue = ComplexFloating(Floating(0));
+
+			for (auto i = 0; i < length; ++i)
+			{
+				remainderValue -= weights[i]*_rightHandSides[i](row);
+				partialSolutionValue += weights[i]*_solutions[i](row);
+			}
+
+			remainder.set(row, remainderValue);
+			partialSolution.set(row, partialSolutionValue);
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+int SolutionHistory<Floating, ComplexFloating>::getLength() const
+{
+	return _length;
+}
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Vector.h"
+#include <vector>
+
+// keeps an orthonormal basis of the last right hand sides together with the matching solutions of the same system,
+// which gives for the next right hand side the initial guess with the smallest residual within the previous solutions
+template<class Floating, class ComplexFloating>
+class SolutionHistory
+{
+public:
+	SolutionHistory(int dimension, int maximumLength);
+
+	void add(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> const &x);
+	Vector<Floating, ComplexFloating> calculateInitialGuess(Vector<Floating, ComplexFloating> const &b) const;
+	void calculateInitialGuess(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> &x) const;
+	void calculatePartialSolution(Vector<Floating, ComplexFloating> const &b, Vector<Floating, ComplexFloating> &remainder, Vector<Floating, ComplexFloating> &partialSolution) const;
+	int getLength() const;
+
+private:
+	const int _dimension;
+	const int _maximumLength;
+	std::vector<Vector<Floating, ComplexFloating>> _rightHandSides;
+	std::vector<Vector<Floating, ComplexFloating>> _solutions;
+	int _length;
+	int _oldest;
+	Vector<Floating, ComplexFloating> _rightHandSide;
+	Vector<Floating, ComplexFloating> _solution;
+	mutable Vector<Floating, ComplexFloating> _remainder;
+	mutable std::vector<ComplexFloating> _weights;
+};
\ No newline at end of file
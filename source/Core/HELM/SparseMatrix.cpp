@@ -1,8 +1,12 @@
 #include "SparseMatrix.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "SparseMatrixRowIterator.h"
 #include "Graph.h"
+#include "ComplexDoubleKernels.h"
 #include <algorithm>
 #include <functional>
 #include <list>
@@ -12,12 +16,16 @@
 
 template class SparseMatrix<long double, Complex<long double> >;
 template class SparseMatrix<MultiPrecision, Complex<MultiPrecision> >;
+template class SparseMatrix<DoubleDouble, Complex<DoubleDouble> >;
+template class SparseMatrix<QuadDouble, Complex<QuadDouble> >;
+template class SparseMatrix<double, Complex<double> >;
 
 template<class Floating, class ComplexFloating>
 SparseMatrix<Floating, ComplexFloating>::SparseMatrix(int rows, int columns) :
 	_rowCount(rows),
 	_columnCount(columns),
-	_zero(Floating(0), Floating(0))
+	_zero(Floating(0), Floating(0)),
+	_frozen(false)
 {
 	checkDimensions();
 	initialize();
@@ -27,7 +35,8 @@ template<class Floating, class ComplexFloating>
 SparseMatrix<Floating, ComplexFloating>::SparseMatrix(std::vector<int> const &permutation) :
 	_rowCount(permutation.size()),
 	_columnCount(permutation.size()),
-	_zero(Floating(0), Floating(0))
+	_zero(Floating(0), Floating(0)),
+	_frozen(false)
 {
 	checkDimensions();
 	initialize();
@@ -36,6 +45,40 @@ SparseMatrix<Floating, ComplexFloating>::SparseMatrix(std::vector<int> const &pe
 		set(i, permutation[i], ComplexFloating(Floating(1)));
 }
 
+template<class Floating, class ComplexFloating>
+SparseMatrix<Floating, ComplexFloating>::SparseMatrix(SparseMatrix<Floating, ComplexFloating> const &rhs) :
+	_rowCount(rhs._rowCount),
+	_columnCount(rhs._columnCount),
+	_zero(rhs._zero),
+	_columns(rhs._columns),
+	_values(rhs._values),
+	_frozen(rhs._frozen),
+	_rowPointers(rhs._rowPointers),
+	_frozenColumns(rhs._frozenColumns),
+	_frozenValues(rhs._frozenValues)
+{ }
+
+template<class Floating, class ComplexFloating>
+SparseMatrix<Floating, ComplexFloating>::SparseMatrix(SparseMatrix<Floating, ComplexFloating> &&rhs) :
+	_rowCount(rhs._rowCount),
+	_columnCount(rhs._columnCount),
+	_zero(rhs._zero),
+	_columns(std::move(rhs._columns)),
+	_values(std::move(rhs._values)),
+	_frozen(rhs._frozen),
+	_rowPointers(std::move(rhs._rowPointers)),
+	_frozenColumns(std::move(rhs._frozenColumns)),
+	_frozenValues(std::move(rhs._frozenValues))
+{
+	rhs._columns.clear();
+	rhs._values.clear();
+	rhs._frozen = false;
+	rhs._rowPointers.clear();
+	rhs._frozenColumns.clear();
+	rhs._frozenValues.clear();
+	rhs.initialize();
+}
+
 template<class Floating, class ComplexFloating>
 int SparseMatrix<Floating, ComplexFloating>::getRowCount() const
 {
@@ -57,59 +100,55 @@ void SparseMatrix<Floating, ComplexFloating>::set(int row, int column, ComplexFl
 		throw std::range_error("invalid column index");
 
 	int position;
-	std::vector<ComplexFloating> &values = _values[row];
 
 	if (findPosition(row, column, position))
 	{
-		values[position] = value;
+		getValuesOfRow(row)[position] = value;
 		return;
 	}
 
+	checkNotFrozen();
 	std::vector<int> &columns = _columns[row];
+	std::vector<ComplexFloating> &values = _values[row];
 
 	columns.insert(columns.begin() + position, column);
 	values.insert(values.begin() + position, value);
 }
 
 template<class Floating, class ComplexFloating>
+template<class Summation>
 void SparseMatrix<Floating, ComplexFloating>::multiply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const
 {
 	if (destination.getCount() != getRowCount() || source.getCount() != getColumnCount())
 		throw std::invalid_argument("sizes of vector and matrix do not match");
 
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
 	#pragma omp parallel
 	{
-		std::vector<Floating> summandsReal;
-		std::vector<Floating> summandsImaginary;
+		MultiPrecisionScope scope(bitPrecision);
+
+		Summation summandsReal;
+		Summation summandsImaginary;
+		ComplexFloating summand;
 
 		#pragma omp for
 		for (auto i = 0; i < _rowCount; ++i)
 		{
-			const std::vector<int> &columns = _columns[i];
-			const std::vector<ComplexFloating> &values = _values[i];
-			const int count = values.size();
-			summandsReal.clear();
-			summandsImaginary.clear();
-			summandsReal.reserve(count);
-			summandsImaginary.reserve(count);
+			auto const columns = getColumnsOfRow(i);
+			auto const values = getValuesOfRow(i);
+			const int count = getElementCountOfRow(i);
+			summandsReal.reset();
+			summandsImaginary.reset();
 
 			for (auto j = 0; j < count; ++j)
 			{
-				auto column = columns[j];
-				ComplexFloating const &value = values[j];
-				auto summand = value*source(column);
-				summandsReal.push_back(std::real(summand));
-				summandsImaginary.push_back(std::imag(summand));
+				summand.assignProduct(values[j], source(columns[j]));
+				summandsReal.add(summand.real());
+				summandsImaginary.add(summand.imag());
 			}
 
-			std::sort(summandsReal.begin(), summandsReal.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-			std::sort(summandsImaginary.begin(), summandsImaginary.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-			ComplexFloating result;
-
-			for (auto j = 0; j < count; ++j)
-				result += ComplexFloating(summandsReal[j], summandsImaginary[j]);
-
-			destination.set(i, result);
+			destination.set(i, ComplexFloating(summandsReal.getResult(), summandsImaginary.getResult()));
 		}
 	}
 }
@@ -119,7 +158,7 @@ ComplexFloating SparseMatrix<Floating, ComplexFloating>::multiplyRowWithStartCol
 {
 	int startPosition;
 	findPosition(row, startColumn, startPosition);
-	auto endPosition = _columns[row].size();
+	auto endPosition = getElementCountOfRow(row);
 	return multiply(vector, startPosition, endPosition, row);
 }
 
@@ -148,7 +187,7 @@ SparseMatrixRowIterator<ComplexFloating> SparseMatrix<Floating, ComplexFloating>
 		throw std::range_error("invalid column index");
 	int startPosition;
 	findPosition(row, startColumn, startPosition);
-	return SparseMatrixRowIterator<ComplexFloating>(_values[row], _columns[row], startPosition, _columns[row].size(), row);
+	return SparseMatrixRowIterator<ComplexFloating>(getValuesOfRow(row), getColumnsOfRow(row), startPosition, getElementCountOfRow(row), row);
 }
 
 template<class Floating, class ComplexFloating>
@@ -160,8 +199,12 @@ int SparseMatrix<Floating, ComplexFloating>::findAbsoluteMaximumOfColumn(int col
 		throw std::range_error("invalid column index");
 	std::list<std::pair<int, Floating>> candidates;
 
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
 	#pragma omp parallel
 	{
+		MultiPrecisionScope scope(bitPrecision);
+
 		auto maximumPartialRow = -1;
 		auto maximumPartialValue = Floating(0);
 
@@ -208,11 +251,11 @@ std::vector<std::pair<int, ComplexFloating>> SparseMatrix<Floating, ComplexFloat
 		throw std::range_error("invalid column index");
 
 	std::vector<std::pair<int, ComplexFloating>> result;
-	size_t elementCount = _columnCount + 1;
+	auto elementCount = _columnCount + 1;
 
 	for (auto row = rowStart; row < _rowCount; ++row)
 	{
-		auto currentElementCount = _values[row].size();
+		auto currentElementCount = getElementCountOfRow(row);
 
 		if (currentElementCount > elementCount)
 			continue;
@@ -241,6 +284,7 @@ void SparseMatrix<Floating, ComplexFloating>::swapRows(int one, int two)
 		throw std::range_error("invalid row index");
 	if (!isValidRowIndex(two))
 		throw std::range_error("invalid row index");
+	checkNotFrozen();
 	
 	if (one == two)
 		return;
@@ -262,14 +306,21 @@ std::vector<std::pair<int, ComplexFloating>> SparseMatrix<Floating, ComplexFloat
 
 	int startPosition;
 	findPosition(row, startColumn, startPosition);
-	const std::vector<int> &columns = _columns[row];
-	const std::vector<ComplexFloating> &values = _values[row];
-	int endPosition = columns.size();
+	auto const columns = getColumnsOfRow(row);
+	auto const values = getValuesOfRow(row);
+	int endPosition = getElementCountOfRow(row);
 	std::vector<std::pair<int, ComplexFloating>> result(endPosition - startPosition);
 
-	#pragma omp parallel for
-	for (auto i = startPosition; i < endPosition; ++i)
-		result[i - startPosition] = std::pair<int, ComplexFloating>(columns[i], values[i]);
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = startPosition; i < endPosition; ++i)
+			result[i - startPosition] = std::pair<int, ComplexFloating>(columns[i], values[i]);
+	}
 
 	return result;
 }
@@ -277,6 +328,8 @@ std::vector<std::pair<int, ComplexFloating>> SparseMatrix<Floating, ComplexFloat
 template<class Floating, class ComplexFloating>
 void SparseMatrix<Floating, ComplexFloating>::compress()
 {
+	checkNotFrozen();
+
 	#pragma omp parallel
 	{
 		std::vector<int> tempColumns;
@@ -315,6 +368,7 @@ void SparseMatrix<Floating, ComplexFloating>::addWeightedRowElements(int row, Co
 {
 	if (!isValidRowIndex(row))
 		throw std::range_error("invalid row index");
+	checkNotFrozen();
 
 	std::vector<ComplexFloating> leftOverValues;
 	std::vector<int> leftOverColumns;
@@ -336,7 +390,7 @@ void SparseMatrix<Floating, ComplexFloating>::addWeightedRowElements(int row, Co
 			++position;
 
 		if (position < count && columns[position] == column)
-			values[position] += weight*i->second;
+			values[position].addProduct(weight, i->second);
 		else
 		{
 			leftOverValues.push_back(i->second);
@@ -359,9 +413,16 @@ Vector<Floating, ComplexFloating> SparseMatrix<Floating, ComplexFloating>::getIn
 	auto minimumDimension = std::min(getRowCount(), getColumnCount());
 	Vector<Floating, ComplexFloating> result(minimumDimension);
 
-	#pragma omp parallel for
-	for (auto i = 0; i < minimumDimension; ++i)
-		result.set(i, ComplexFloating(Floating(1))/(*this)(i, i));
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < minimumDimension; ++i)
+			result.set(i, ComplexFloating(Floating(1))/(*this)(i, i));
+	}
 
 	return result;
 }
@@ -369,13 +430,21 @@ Vector<Floating, ComplexFloating> SparseMatrix<Floating, ComplexFloating>::getIn
 template<class Floating, class ComplexFloating>
 void SparseMatrix<Floating, ComplexFloating>::multiplyWithDiagonalMatrix(Vector<Floating, ComplexFloating> const &diagonalValues)
 {
-	#pragma omp parallel for
-	for (auto row = 0; row < _rowCount; ++row)
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
 	{
-		auto diagonalValue = diagonalValues(row);
-		std::vector<ComplexFloating> &values = _values[row];
-		for (size_t i = 0; i < values.size(); ++i)
-			values[i] *= diagonalValue;
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto row = 0; row < _rowCount; ++row)
+		{
+			auto diagonalValue = diagonalValues(row);
+			auto values = getValuesOfRow(row);
+			const int count = getElementCountOfRow(row);
+			for (auto i = 0; i < count; ++i)
+				values[i] *= diagonalValue;
+		}
 	}
 }
 
@@ -386,13 +455,14 @@ int SparseMatrix<Floating, ComplexFloating>::calculateBandwidth() const
 
 	for (auto row = 0; row < _rowCount; ++row)
 	{
-		std::vector<int> const &columns = _columns[row];
+		auto const columns = getColumnsOfRow(row);
+		const int count = getElementCountOfRow(row);
 
-		if (columns.empty())
+		if (count == 0)
 			continue;
 
 		auto start = std::min(columns[0], row);
-		auto end = std::max(columns[columns.size() - 1], row);
+		auto end = std::max(columns[count - 1], row);
 		result = std::max(result, end - start);
 	}
 
@@ -403,6 +473,7 @@ template<class Floating, class ComplexFloating>
 std::vector<int> SparseMatrix<Floating, ComplexFloating>::reduceBandwidth()
 {
 	assert(_rowCount == _columnCount);
+	checkNotFrozen();
 
 	auto graph = createGraph();
 	auto startNode = graph->findPseudoPeriphereNode();
@@ -416,10 +487,28 @@ std::vector<int> SparseMatrix<Floating, ComplexFloating>::reduceBandwidth()
 	return permutation;
 }
 
+template<class Floating, class ComplexFloating>
+std::vector<int> SparseMatrix<Floating, ComplexFloating>::reduceFillIn()
+{
+	assert(_rowCount == _columnCount);
+	checkNotFrozen();
+
+	auto graph = createGraph();
+	auto permutation = graph->calculateMinimumDegreeOrdering();
+	delete graph;
+	graph = 0;
+
+	permutateRows(permutation);
+	permutateColumns(permutation);
+
+	return permutation;
+}
+
 template<class Floating, class ComplexFloating>
 void SparseMatrix<Floating, ComplexFloating>::transpose()
 {
 	assert(_rowCount == _columnCount);
+	checkNotFrozen();
 
 	std::vector<std::vector<int>> columns;
 	std::vector<std::vector<ComplexFloating>> values;
@@ -467,6 +556,7 @@ void SparseMatrix<Floating, ComplexFloating>::permutateRows(std::vector<int> con
 {
 	if (permutation.size() != getRowCount())
 		throw std::invalid_argument("size of permutation does not match row count");
+	checkNotFrozen();
 	
 	std::vector<std::vector<int>> columns;
 	std::vector<std::vector<ComplexFloating>> values;
@@ -488,6 +578,7 @@ void SparseMatrix<Floating, ComplexFloating>::permutateColumns(std::vector<int>
 {
 	if (permutation.size() != getColumnCount())
 		throw std::invalid_argument("size of permutation does not match column count");
+	checkNotFrozen();
 
 	typedef std::pair<int, ComplexFloating> ColumnValue;
 	std::vector<ColumnValue> columnValues;
@@ -512,7 +603,7 @@ void SparseMatrix<Floating, ComplexFloating>::permutateColumns(std::vector<int>
 		values.clear();
 		columns.clear();
 
-		for (auto columnValue : columnValues)
+		for (auto const &columnValue : columnValues)
 		{
 			columns.push_back(columnValue.first);
 			values.push_back(columnValue.second);
@@ -542,7 +633,7 @@ ComplexFloating const& SparseMatrix<Floating, ComplexFloating>::operator()(int r
 {
 	int position;
 	if (findPosition(row, column, position))
-		return _values[row][position];
+		return getValuesOfRow(row)[position];
 
 	return _zero;
 }
@@ -554,9 +645,95 @@ SparseMatrix<Floating, ComplexFloating> const& SparseMatrix<Floating, ComplexFlo
 		throw std::invalid_argument("sizes of matrices do not match");
 	_columns = rhs._columns;
 	_values = rhs._values;
+	_frozen = rhs._frozen;
+	_rowPointers = rhs._rowPointers;
+	_frozenColumns = rhs._frozenColumns;
+	_frozenValues = rhs._frozenValues;
+	return *this;
+}
+
+template<class Floating, class ComplexFloating>
+SparseMatrix<Floating, ComplexFloating> const& SparseMatrix<Floating, ComplexFloating>::operator=(SparseMatrix<Floating, ComplexFloating> &&rhs)
+{
+	if (getRowCount() != rhs.getRowCount() || getColumnCount() != rhs.getColumnCount())
+		throw std::invalid_argument("sizes of matrices do not match");
+	_columns.swap(rhs._columns);
+	_values.swap(rhs._values);
+	std::swap(_frozen, rhs._frozen);
+	_rowPointers.swap(rhs._rowPointers);
+	_frozenColumns.swap(rhs._frozenColumns);
+	_frozenValues.swap(rhs._frozenValues);
 	return *this;
 }
 
+template<class Floating, class ComplexFloating>
+void SparseMatrix<Floating, ComplexFloating>::freeze()
+{
+	if (_frozen)
+		return;
+
+	_rowPointers.resize(_rowCount + 1);
+	_rowPointers[0] = 0;
+
+	for (auto row = 0; row < _rowCount; ++row)
+		_rowPointers[row + 1] = _rowPointers[row] + _columns[row].size();
+
+	_frozenColumns.clear();
+	_frozenValues.clear();
+	_frozenColumns.reserve(_rowPointers[_rowCount]);
+	_frozenValues.reserve(_rowPointers[_rowCount]);
+
+	for (auto row = 0; row < _rowCount; ++row)
+	{
+		_frozenColumns.insert(_frozenColumns.end(), _columns[row].begin(), _columns[row].end());
+		_frozenValues.insert(_frozenValues.end(), _values[row].begin(), _values[row].end());
+		std::vector<int>().swap(_columns[row]);
+		std::vector<ComplexFloating>().swap(_values[row]);
+	}
+
+	_frozen = true;
+}
+
+template<class Floating, class ComplexFloating>
+void SparseMatrix<Floating, ComplexFloating>::unfreeze()
+{
+	if (!_frozen)
+		return;
+
+	for (auto row = 0; row < _rowCount; ++row)
+	{
+		auto start = _rowPointers[row];
+		auto end = _rowPointers[row + 1];
+		_columns[row].assign(_frozenColumns.begin() + start, _frozenColumns.begin() + end);
+		_values[row].assign(_frozenValues.begin() + start, _frozenValues.begin() + end);
+	}
+
+	std::vector<int>().swap(_rowPointers);
+	std::vector<int>().swap(_frozenColumns);
+	std::vector<ComplexFloating>().swap(_frozenValues);
+	_frozen = false;
+}
+
+template<class Floating, class ComplexFloating>
+bool SparseMatrix<Floating, ComplexFloating>::isFrozen() const
+{
+	return _frozen;
+}
+
+template<class Floating, class ComplexFloating>
+int SparseMatrix<Floating, ComplexFloating>::getNonZeroCount() const
+{
+	if (_frozen)
+		return _rowPointers[_rowCount];
+
+	auto result = 0;
+
+	for (auto row = 0; row < _rowCount; ++row)
+		result += _columns[row].size();
+
+	return result;
+}
+
 template<class Floating, class ComplexFloating>
 std::vector<int> SparseMatrix<Floating, ComplexFloating>::invertPermutation(std::vector<int> const &permutation)
 {	
@@ -593,8 +770,8 @@ bool SparseMatrix<Floating, ComplexFloating>::findPosition(int row, int column,
 	if (!isValidColumnIndex(column))
 		throw std::range_error("invalid column index");
 
-	const std::vector<int> &columns = _columns[row];
-	const int count = columns.size();
+	auto const columns = getColumnsOfRow(row);
+	const int count = getElementCountOfRow(row);
 	auto start = 0;
 	auto end = count;
 
@@ -639,59 +816,92 @@ bool SparseMatrix<Floating, ComplexFloating>::isValidColumnIndex(int column) con
 	return column >= 0 && column < getColumnCount();
 }
 
+template<class Floating, class ComplexFloating>
+void SparseMatrix<Floating, ComplexFloating>::checkNotFrozen() const
+{
+	if (_frozen)
+		throw std::logic_error("structure of a frozen matrix can not be changed");
+}
+
+template<class Floating, class ComplexFloating>
+int SparseMatrix<Floating, ComplexFloating>::getElementCountOfRow(int row) const
+{
+	if (_frozen)
+		return _rowPointers[row + 1] - _rowPointers[row];
+
+	return _columns[row].size();
+}
+
+template<class Floating, class ComplexFloating>
+int const* SparseMatrix<Floating, ComplexFloating>::getColumnsOfRow(int row) const
+{
+	if (_frozen)
+		return _frozenColumns.data() + _rowPointers[row];
+
+	return _columns[row].data();
+}
+
+template<class Floating, class ComplexFloating>
+ComplexFloating const* SparseMatrix<Floating, ComplexFloating>::getValuesOfRow(int row) const
+{
+	if (_frozen)
+		return _frozenValues.data() + _rowPointers[row];
+
+	return _values[row].data();
+}
+
+template<class Floating, class ComplexFloating>
+ComplexFloating* SparseMatrix<Floating, ComplexFloating>::getValuesOfRow(int row)
+{
+	if (_frozen)
+		return _frozenValues.data() + _rowPointers[row];
+
+	return _values[row].data();
+}
+
 template<class Floating, class ComplexFloating>
 ComplexFloating SparseMatrix<Floating, ComplexFloating>::multiply(Vector<Floating, ComplexFloating> const &vector, int startPosition, int endPosition, int row) const
 {	
-	auto count = endPosition - startPosition;
-	std::vector<Floating> summandsRealTotal;
-	std::vector<Floating> summandsImaginaryTotal;
-	ComplexFloating resultTotal(Floating(0));
-	summandsRealTotal.reserve(count);
-	summandsImaginaryTotal.reserve(count);
-	const std::vector<int> &columns = _columns[row];
-	const std::vector<ComplexFloating> &values = _values[row];
+	auto const columns = getColumnsOfRow(row);
+	auto const values = getValuesOfRow(row);
+	SummationNeumaier<Floating> summandsReal;
+	SummationNeumaier<Floating> summandsImaginary;
+	ComplexFloating summand;
 
-	#pragma omp parallel
+	for (auto i = startPosition; i < endPosition; ++i)
 	{
-		std::vector<Floating> summandsReal;
-		std::vector<Floating> summandsImaginary;
-		summandsReal.reserve(count);
-		summandsImaginary.reserve(count);
+		summand.assignProduct(values[i], vector(columns[i]));
+		summandsReal.add(summand.real());
+		summandsImaginary.add(summand.imag());
+	}
 
-		#pragma omp for
-		for (auto i = startPosition; i < endPosition; ++i)
-		{
-			auto column = columns[i];
-			auto summand = values[i]*vector(column);
-			summandsReal.push_back(std::real(summand));
-			summandsImaginary.push_back(std::imag(summand));
-		}
+	return ComplexFloating(summandsReal.getResult(), summandsImaginary.getResult());
+}
 
-		#pragma omp critical
-		{
-			summandsRealTotal.insert(summandsRealTotal.begin(), summandsReal.begin(), summandsReal.end());
-			summandsImaginaryTotal.insert(summandsImaginaryTotal.begin(), summandsImaginary.begin(), summandsImaginary.end());
-		}
-	}
+template<>
+template<>
+void SparseMatrix<double, Complex<double>>::multiply<SummationNeumaier<double>>(Vector<double, Complex<double>> &destination, Vector<double, Complex<double>> const &source) const
+{
+	if (destination.getCount() != getRowCount() || source.getCount() != getColumnCount())
+		throw std::invalid_argument("sizes of vector and matrix do not match");
 
-	std::sort(summandsRealTotal.begin(), summandsRealTotal.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-	std::sort(summandsImaginaryTotal.begin(), summandsImaginaryTotal.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
+	if (_columnCount == 0)
+		return;
 
-	#pragma omp parallel
-	{
-		ComplexFloating result(Floating(0));
+	auto const sourceValues = &source(0);
 
-		#pragma omp for
-		for (auto j = 0; j < count; ++j)
-			result += ComplexFloating(summandsRealTotal[j], summandsImaginaryTotal[j]);
+	#pragma omp parallel for
+	for (auto i = 0; i < _rowCount; ++i)
+		destination.set(i, calculateComplexSparseProduct(getValuesOfRow(i), getColumnsOfRow(i), getElementCountOfRow(i), sourceValues));
+}
 
-		#pragma omp critical
-		{
-			resultTotal += result;
-		}
-	}
+template<>
+Complex<double> SparseMatrix<double, Complex<double>>::multiply(Vector<double, Complex<double>> const &vector, int startPosition, int endPosition, int row) const
+{
+	if (startPosition >= endPosition)
+		return Complex<double>();
 
-	return resultTotal;
+	return calculateComplexSparseProduct(getValuesOfRow(row) + startPosition, getColumnsOfRow(row) + startPosition, endPosition - startPosition, &vector(0));
 }
 
 template<class Floating, class ComplexFloating>
@@ -701,7 +911,7 @@ SparseMatrixRowIterator<ComplexFloating>* SparseMatrix<Floating, ComplexFloating
 		throw std::range_error("invalid row index");
 	int startPosition;
 	findPosition(row, 0, startPosition);
-	return new SparseMatrixRowIterator<ComplexFloating>(_values[row], _columns[row], startPosition, _columns[row].size(), row);
+	return new SparseMatrixRowIterator<ComplexFloating>(getValuesOfRow(row), getColumnsOfRow(row), startPosition, getElementCountOfRow(row), row);
 }
 
 template<class Floating, class ComplexFloating>
@@ -718,3 +928,23 @@ Graph* SparseMatrix<Floating, ComplexFloating>::createGraph() const
 
 	return graph;
 }
+
+template void SparseMatrix<long double, Complex<long double> >::multiply<SummationNaive<long double> >(Vector<long double, Complex<long double> > &destination, Vector<long double, Complex<long double> > const &source) const;
+template void SparseMatrix<long double, Complex<long double> >::multiply<SummationNeumaier<long double> >(Vector<long double, Complex<long double> > &destination, Vector<long double, Complex<long double> > const &source) const;
+template void SparseMatrix<long double, Complex<long double> >::multiply<SummationPairwise<long double> >(Vector<long double, Complex<long double> > &destination, Vector<long double, Complex<long double> > const &source) const;
+template void SparseMatrix<long double, Complex<long double> >::multiply<SummationSorted<long double> >(Vector<long double, Complex<long double> > &destination, Vector<long double, Complex<long double> > const &source) const;
+template void SparseMatrix<MultiPrecision, Complex<MultiPrecision> >::multiply<SummationNaive<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > &destination, Vector<MultiPrecision, Complex<MultiPrecision> > const &source) const;
+template void SparseMatrix<MultiPrecision, Complex<MultiPrecision> >::multiply<SummationNeumaier<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > &destination, Vector<MultiPrecision, Complex<MultiPrecision> > const &source) const;
+template void SparseMatrix<MultiPrecision, Complex<MultiPrecision> >::multiply<SummationPairwise<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > &destination, Vector<MultiPrecision, Complex<MultiPrecision> > const &source) const;
+template void SparseMatrix<MultiPrecision, Complex<MultiPrecision> >::multiply<SummationSorted<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > &destination, Vector<MultiPrecision, Complex<MultiPrecision> > const &source) const;
+template void SparseMatrix<DoubleDouble, Complex<DoubleDouble> >::multiply<SummationNaive<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > &destination, Vector<DoubleDouble, Complex<DoubleDouble> > const &source) const;
+template void SparseMatrix<DoubleDouble, Complex<DoubleDouble> >::multiply<SummationNeumaier<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > &destination, Vector<DoubleDouble, Complex<DoubleDouble> > const &source) const;
+template void SparseMatrix<DoubleDouble, Complex<DoubleDouble> >::multiply<SummationPairwise<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > &destination, Vector<DoubleDouble, Complex<DoubleDouble> > const &source) const;
+template void SparseMatrix<DoubleDouble, Complex<DoubleDouble> >::multiply<SummationSorted<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > &destination, Vector<DoubleDouble, Complex<DoubleDouble> > const &source) const;
+template void SparseMatrix<QuadDouble, Complex<QuadDouble> >::multiply<SummationNaive<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > &destination, Vector<QuadDouble, Complex<QuadDouble> > const &source) const;
+template void SparseMatrix<QuadDouble, Complex<QuadDouble> >::multiply<SummationNeumaier<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > &destination, Vector<QuadDouble, Complex<QuadDouble> > const &source) const;
+template void SparseMatrix<QuadDouble, Complex<QuadDouble> >::multiply<SummationPairwise<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > &destination, Vector<QuadDouble, Complex<QuadDouble> > const &source) const;
+template void SparseMatrix<QuadDouble, Complex<QuadDouble> >::multiply<SummationSorted<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > &destination, Vector<QuadDouble, Complex<QuadDouble> > const &source) const;
+template void SparseMatrix<double, Complex<double> >::multiply<SummationNaive<double> >(Vector<double, Complex<double> > &destination, Vector<double, Complex<double> > const &source) const;
+template void SparseMatrix<double, Complex<double> >::multiply<SummationPairwise<double> >(Vector<double, Complex<double> > &destination, Vector<double, Complex<double> > const &source) const;
+template void SparseMatrix<double, Complex<double> >::multiply<SummationSorted<double> >(Vector<double, Complex<double> > &destination, Vector<double, Complex<double> > const &source) const;
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <iostream>
 #include <sstream>
 #include "Vector.h"
+#include "Complex.h"
 #include "SparseMatrixRowIterator.h"
 
 class Graph;
@@ -15,11 +16,14 @@ class SparseMatrix
 public:
 	SparseMatrix(int rows, int columns);
 	SparseMatrix(std::vector<int> const &permutation);
+	SparseMatrix(SparseMatrix<Floating, ComplexFloating> const &rhs);
+	// the rows are taken over without a copy, and the moved from matrix is left without any non zero elements
+	SparseMatrix(SparseMatrix<Floating, ComplexFloating> &&rhs);
 
 	int getRowCount() const;
 	int getColumnCount() const;
 	void set(int row, int column, ComplexFloating const &value);
-	void multiply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const;
+	template<class Summation = SummationNeumaier<Floating>> void multiply(Vector<Floating, ComplexFloating> &destination, Vector<Floating, ComplexFloating> const &source) const;
 	ComplexFloating multiplyRowWithStartColumn(int row, Vector<Floating, ComplexFloating> const &vector, int startColumn) const;
 	ComplexFloating multiplyRowWithEndColumn(int row, Vector<Floating, ComplexFloating> const &vector, int endColumn) const;
 	SparseMatrixRowIterator<ComplexFloating> getRowIterator(int row) const;
@@ -34,14 +38,21 @@ public:
 	void multiplyWithDiagonalMatrix(Vector<Floating, ComplexFloating> const &diagonalValues);
 	int calculateBandwidth() const;
 	std::vector<int> reduceBandwidth();
+	std::vector<int> reduceFillIn();
 	void transpose();
 	void permutateRows(std::vector<int> const &permutation);
 	void permutateColumns(std::vector<int> const &permutation);
 	SparseMatrix<Floating, ComplexFloating> createReducedMatrix(int rows, int columns) const;
 	Graph* createGraph() const;
+	void freeze();
+	void unfreeze();
+	bool isFrozen() const;
+	int getNonZeroCount() const;
 
 	ComplexFloating const& operator()(int row, int column) const;
 	SparseMatrix<Floating, ComplexFloating> const& operator=(SparseMatrix<Floating, ComplexFloating> const &rhs);
+	// the rows are exchanged, therefore the moved from matrix keeps the previous content of this one
+	SparseMatrix<Floating, ComplexFloating> const& operator=(SparseMatrix<Floating, ComplexFloating> &&rhs);
 
 	static std::vector<int> invertPermutation(std::vector<int> const &permutation);
 
@@ -51,6 +62,11 @@ private:
 	bool findPosition(int row, int column, int &position) const;
 	bool isValidRowIndex(int row) const;
 	bool isValidColumnIndex(int column) const;
+	void checkNotFrozen() const;
+	int getElementCountOfRow(int row) const;
+	int const* getColumnsOfRow(int row) const;
+	ComplexFloating const* getValuesOfRow(int row) const;
+	ComplexFloating* getValuesOfRow(int row);
 	ComplexFloating multiply(Vector<Floating, ComplexFloating> const &vector, int startPosition, int endPosition, int row) const;
 	SparseMatrixRowIterator<ComplexFloating>* getRowIteratorPointer(int row) const;
 
@@ -60,8 +76,19 @@ private:
 	const ComplexFloating _zero;
 	std::vector<std::vector<int>> _columns;
 	std::vector<std::vector<ComplexFloating>> _values;
+	bool _frozen;
+	std::vector<int> _rowPointers;
+	std::vector<int> _frozenColumns;
+	std::vector<ComplexFloating> _frozenValues;
 };
 
+// these use the vectorized kernels for double
+template<>
+template<>
+void SparseMatrix<double, Complex<double>>::multiply<SummationNeumaier<double>>(Vector<double, Complex<double>> &destination, Vector<double, Complex<double>> const &source) const;
+template<>
+Complex<double> SparseMatrix<double, Complex<double>>::multiply(Vector<double, Complex<double>> const &vector, int startPosition, int endPosition, int row) const;
+
 template<class Floating, class ComplexFloating>
 bool operator==(SparseMatrix<Floating, ComplexFloating> const &one, SparseMatrix<Floating, ComplexFloating> const &two)
 {
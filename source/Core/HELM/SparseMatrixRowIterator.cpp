@@ -1,13 +1,18 @@
 #include "SparseMatrixRowIterator.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include <assert.h>
 
 template class SparseMatrixRowIterator< Complex<long double> >;
 template class SparseMatrixRowIterator< Complex<MultiPrecision> >;
+template class SparseMatrixRowIterator< Complex<DoubleDouble> >;
+template class SparseMatrixRowIterator< Complex<QuadDouble> >;
+template class SparseMatrixRowIterator< Complex<double> >;
 
 template<class T>
-SparseMatrixRowIterator<T>::SparseMatrixRowIterator(std::vector<T> const &values, std::vector<int> const &columns, int start, int end, int row) :
+SparseMatrixRowIterator<T>::SparseMatrixRowIterator(T const *values, int const *columns, int start, int end, int row) :
 	_values(values),
 	_columns(columns),
 	_startPosition(start),
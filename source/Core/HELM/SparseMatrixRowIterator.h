@@ -6,7 +6,7 @@ template<class T>
 class SparseMatrixRowIterator
 {
 public:
-	SparseMatrixRowIterator(std::vector<T> const &values, std::vector<int> const &columns, int start, int end, int row);
+	SparseMatrixRowIterator(T const *values, int const *columns, int start, int end, int row);
 
 	bool isValid() const;
 	void next();
@@ -16,8 +16,8 @@ public:
 	int getNonZeroCount() const;
 
 private:
-	const std::vector<T> &_values;
-	const std::vector<int> &_columns;
+	T const *_values;
+	int const *_columns;
 	const int _startPosition;
 	const int _endPosition;
 	const int _row;
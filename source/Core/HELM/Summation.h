@@ -0,0 +1,162 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include "MultiPrecision.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
+
+template<class Floating>
+bool isAbsoluteValueGreaterOrEqual(Floating const &lhs, Floating const &rhs)
+{
+	return std::abs(lhs) >= std::abs(rhs);
+}
+
+template<class Floating>
+class SummationNaive
+{
+public:
+	SummationNaive() :
+		_sum(0)
+	{ }
+
+	void reset()
+	{
+		_sum = Floating(0);
+	}
+
+	void add(Floating const &value)
+	{
+		_sum += value;
+	}
+
+	Floating getResult() const
+	{
+		return _sum;
+	}
+
+private:
+	Floating _sum;
+};
+
+// Kahan-Babuska summation in the variant of Neumaier, which also compensates summands bigger than the current sum
+template<class Floating>
+class SummationNeumaier
+{
+public:
+	SummationNeumaier() :
+		_sum(0),
+		_compensation(0),
+		_nextSum(0),
+		_error(0)
+	{ }
+
+	void reset()
+	{
+		_sum = Floating(0);
+		_compensation = Floating(0);
+	}
+
+	// works only with compound assignments on members, therefore no temporaries are created for types like MultiPrecision
+	void add(Floating const &value)
+	{
+		_nextSum = _sum;
+		_nextSum += value;
+
+		if (isAbsoluteValueGreaterOrEqual(_sum, value))
+		{
+			_error = _sum;
+			_error -= _nextSum;
+			_error += value;
+		}
+		else
+		{
+			_error = value;
+			_error -= _nextSum;
+			_error += _sum;
+		}
+
+		_compensation += _error;
+		_sum = _nextSum;
+	}
+
+	Floating getResult() const
+	{
+		return _sum + _compensation;
+	}
+
+private:
+	Floating _sum;
+	Floating _compensation;
+	Floating _nextSum;
+	Floating _error;
+};
+
+template<class Floating>
+class SummationPairwise
+{
+public:
+	void reset()
+	{
+		_summands.clear();
+	}
+
+	void add(Floating const &value)
+	{
+		_summands.push_back(value);
+	}
+
+	Floating getResult() const
+	{
+		return sum(0, _summands.size());
+	}
+
+private:
+	Floating sum(size_t start, size_t end) const
+	{
+		if (end - start <= 8)
+		{
+			Floating result(0);
+
+			for (auto i = start; i < end; ++i)
+				result += _summands[i];
+
+			return result;
+		}
+
+		auto middle = start + (end - start)/2;
+		return sum(start, middle) + sum(middle, end);
+	}
+
+private:
+	std::vector<Floating> _summands;
+};
+
+template<class Floating>
+class SummationSorted
+{
+public:
+	void reset()
+	{
+		_summands.clear();
+	}
+
+	void add(Floating const &value)
+	{
+		_summands.push_back(value);
+	}
+
+	Floating getResult() const
+	{
+		std::sort(_summands.begin(), _summands.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
+		Floating result(0);
+
+		for (auto &summand : _summands)
+			result += summand;
+
+		return result;
+	}
+
+private:
+	mutable std::vector<Floating> _summands;
+};
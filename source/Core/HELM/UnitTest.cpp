@@ -2,20 +2,39 @@
 #include "Complex.h"
 #include "CoefficientStorage.h"
 #include "AnalyticContinuation.h"
+#include "AnalyticContinuationViskovatov.h"
 #include "ILinearEquationSystemSolver.h"
 #include "BiCGSTAB.h"
+#include "PreconditionerJacobi.h"
+#include "PreconditionerIncompleteLU.h"
+#include "SolutionHistory.h"
 #include "LUDecompositionStable.h"
 #include "LUDecompositionSparse.h"
 #include "SOR.h"
 #include "Vector.h"
 #include "SparseMatrix.h"
 #include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
 #include "NumericalTraits.h"
 #include "Graph.h"
+#include "Summation.h"
+#include "RelaxedConvolution.h"
+#include "CalculatorDouble.h"
+#include "CalculatorLongDouble.h"
+#include "CalculatorDoubleDouble.h"
+#include "CalculatorQuadDouble.h"
+#include "CalculatorMulti.h"
+#include "CalculatorRegister.h"
+#include "CancellationToken.h"
+#include "HeapAllocationCounter.h"
 #include <sstream>
 #include <fstream>
 #include <algorithm>
 #include <chrono>
+#include <thread>
+#include <atomic>
+#include <utility>
+#include <omp.h>
 
 using namespace std;
 
@@ -49,6 +68,17 @@ bool areEqual(Vector<long double, Complex<long double>> const& one, Vector<long
 	return true;
 }
 
+// values of varying magnitude and sign, which are exactly representable as double
+Complex<double> createDoubleTestValue(int i, int offset)
+{
+	return Complex<double>(ldexp(sin(1.3*i + offset), i%7 - 3), ldexp(cos(0.7*i - offset), i%5 - 2));
+}
+
+Complex<long double> toLongDouble(Complex<double> const &value)
+{
+	return Complex<long double>(value.real(), value.imag());
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsComplexDouble()
 {
 	Complex<double> one(2, 3);
@@ -185,6 +215,233 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsMultiPrecision()
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsMultiPrecisionAllocations()
+{
+	Complex<MultiPrecision> one(MultiPrecision(1.5), MultiPrecision(-2));
+	Complex<MultiPrecision> two(MultiPrecision(0.5), MultiPrecision(3));
+	Complex<MultiPrecision> result;
+	SummationNeumaier<MultiPrecision> summation;
+	// the thread local scratch values are allocated during the first usage
+	result.assignProduct(one, two);
+	result.addProduct(one, two);
+	summation.add(result.real());
+
+	MultiPrecision::startAllocationCounting();
+
+	for (auto i = 0; i < 100; ++i)
+	{
+		result.assignProduct(one, two);
+		result.addProduct(one, two);
+		result.subtractProduct(one, two);
+		summation.add(result.real());
+	}
+
+	auto fusedAllocationCount = MultiPrecision::getAllocationCount();
+	MultiPrecision::startAllocationCounting();
+	auto product = one*two;
+	auto productAllocationCount = MultiPrecision::getAllocationCount();
+	MultiPrecision::stopAllocationCounting();
+
+	if (fusedAllocationCount != 0)
+		return false;
+
+	// two for the parts of the result and two more, if the copy of the return value is not elided
+	if (productAllocationCount == 0 || productAllocationCount > 4)
+		return false;
+
+	if (!areEqual(result, Complex<MultiPrecision>(MultiPrecision(6.75), MultiPrecision(3.5)), 1e-30))
+		return false;
+
+	if (!areEqual(product, result, 1e-30))
+		return false;
+
+	if (std::abs(summation.getResult() - MultiPrecision(688.5)) > MultiPrecision(1e-30))
+		return false;
+
+	if (!isAbsoluteValueGreaterOrEqual(MultiPrecision(-3), MultiPrecision(2)) || isAbsoluteValueGreaterOrEqual(MultiPrecision(2), MultiPrecision(-3)))
+		return false;
+
+	if (isAbsoluteValueGreaterOrEqual(MultiPrecision(-2), MultiPrecision(-3)) || !isAbsoluteValueGreaterOrEqual(MultiPrecision(3), MultiPrecision(-3)))
+		return false;
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsMultiPrecisionScope()
+{
+	auto previousBitPrecision = MultiPrecision::getBitPrecision();
+	unsigned int otherThreadBitPrecision = 0;
+
+	{
+		MultiPrecisionScope scope(512);
+
+		if (MultiPrecision::getBitPrecision() != 512)
+			return false;
+
+		thread otherThread([&otherThreadBitPrecision]() { otherThreadBitPrecision = MultiPrecision::getBitPrecision(); });
+		otherThread.join();
+
+		if (MultiPrecision().getValue().get_prec() < 512)
+			return false;
+	}
+
+	if (MultiPrecision::getBitPrecision() != previousBitPrecision || otherThreadBitPrecision == 512)
+		return false;
+
+	MultiPrecision low(1, 64);
+	MultiPrecision high(1, 512);
+
+	{
+		MultiPrecisionScope scope(512);
+		low = high;
+
+		if (low.getValue().get_prec() != MultiPrecision().getValue().get_prec())
+			return false;
+	}
+
+	MultiPrecisionScope scope(64);
+	high = low;
+	return high.getValue().get_prec() == MultiPrecision().getValue().get_prec();
+}
+
+// like a worker of the pool, which runs a calculation with a low precision after one with a high precision
+extern "C" __declspec(dllexport) bool __cdecl RunTestsMultiPrecisionScratchAfterHigherPrecision()
+{
+	auto calculate = [](unsigned int bitPrecision)
+	{
+		MultiPrecisionScope scope(bitPrecision);
+		Complex<MultiPrecision> one(MultiPrecision(1)/MultiPrecision(3), MultiPrecision(2));
+		Complex<MultiPrecision> two(MultiPrecision(0.5), MultiPrecision(1)/MultiPrecision(7));
+		Complex<MultiPrecision> result;
+		result.assignProduct(one, two);
+		result.addProduct(one, two);
+		auto precision = MultiPrecision().getValue().get_prec();
+		return	result.real().getValue().get_prec() == precision && result.imag().getValue().get_prec() == precision &&
+				MultiPrecision::getScratch(0).getValue().get_prec() == precision;
+	};
+	auto highPrecisionCorrect = false;
+	auto lowPrecisionCorrect = false;
+
+	thread worker([&]()
+	{
+		highPrecisionCorrect = calculate(2048);
+		lowPrecisionCorrect = calculate(128);
+	});
+	worker.join();
+
+	return highPrecisionCorrect && lowPrecisionCorrect;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsMultiPrecisionScopeInParallelRegions()
+{
+	const int count = 1000;
+	MultiPrecisionScope scope(512);
+	Vector<MultiPrecision, Complex<MultiPrecision> > a(count);
+	Vector<MultiPrecision, Complex<MultiPrecision> > b(count);
+
+	for (auto i = 0; i < count; ++i)
+	{
+		a.set(i, Complex<MultiPrecision>(MultiPrecision(1, 512)/MultiPrecision(3, 512), MultiPrecision(0, 512)));
+		b.set(i, Complex<MultiPrecision>(MultiPrecision(3, 512), MultiPrecision(0, 512)));
+	}
+
+	// like the threads of a pool, which did not take part in any parallel region of this thread before
+	#pragma omp parallel
+	if (omp_get_thread_num() != 0)
+		MultiPrecision::setDefaultPrecision(64);
+
+	auto result = a.dot(b);
+
+	#pragma omp parallel
+	if (omp_get_thread_num() != 0)
+		MultiPrecision::setDefaultPrecision(300);
+
+	if (result.real().getValue().get_prec() < 512)
+		return false;
+
+	return std::abs(result.real() - MultiPrecision(count, 512)) < MultiPrecision(1e-140, 512);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsDoubleDouble()
+{
+	DoubleDouble one(-2.3);
+	DoubleDouble two(5);
+
+	if (one == two)
+		return false;
+	if (!(one != two))
+		return false;
+	if (one > two)
+		return false;
+	if (!(one < two))
+		return false;
+	if (!(two > one))
+		return false;
+	if (two < one)
+		return false;
+
+	DoubleDouble tiny(pow(2.0, -80));
+	DoubleDouble unity(1);
+
+	if ((unity + tiny) - unity != tiny)
+		return false;
+
+	DoubleDouble three(3);
+
+	if (std::abs((unity/three)*three - unity) > DoubleDouble(1e-31))
+		return false;
+
+	DoubleDouble root = std::sqrt(DoubleDouble(2));
+
+	if (std::abs(root*root - DoubleDouble(2)) > DoubleDouble(1e-30))
+		return false;
+
+	if (static_cast<double>(DoubleDouble(4)) != 4)
+		return false;
+
+	return std::ceil(DoubleDouble(2.5)) == DoubleDouble(3);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsQuadDouble()
+{
+	QuadDouble one(-2.3);
+	QuadDouble two(5);
+
+	if (one == two)
+		return false;
+	if (!(one != two))
+		return false;
+	if (one > two)
+		return false;
+	if (!(one < two))
+		return false;
+	if (!(two > one))
+		return false;
+	if (two < one)
+		return false;
+
+	QuadDouble tiny(pow(2.0, -180));
+	QuadDouble unity(1);
+
+	if ((unity + tiny) - unity != tiny)
+		return false;
+
+	QuadDouble three(3);
+
+	if (std::abs((unity/three)*three - unity) > QuadDouble(1e-62))
+		return false;
+
+	QuadDouble root = std::sqrt(QuadDouble(2));
+
+	if (std::abs(root*root - QuadDouble(2)) > QuadDouble(1e-62))
+		return false;
+
+	if (static_cast<double>(QuadDouble(4)) != 4)
+		return false;
+
+	return std::ceil(QuadDouble(2.5)) == QuadDouble(3);
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsCoefficientStoragePQ()
 {
 	vector<PQBus> pqBuses;
@@ -335,6 +592,186 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsCoefficientStorageMixed()
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCoefficientStorageLayouts()
+{
+	vector<PQBus> pqBuses;
+	pqBuses.push_back(PQBus(3, Complex<long double>()));
+	pqBuses.push_back(PQBus(0, Complex<long double>()));
+	vector<PVBus> pvBuses;
+	pvBuses.push_back(PVBus(1, 0, 0.7));
+	pvBuses.push_back(PVBus(2, 0, 1.1));
+	SparseMatrix<long double, Complex<long double> > admittances(4, 4);
+
+	for (auto i = 0; i < 4; ++i)
+	{
+		admittances.set(i, i, Complex<long double>(20 + i, 10));
+		admittances.set(i, (i + 1)%4, Complex<long double>(-10, i));
+		admittances.set((i + 1)%4, i, Complex<long double>(-10, -i));
+	}
+
+	CoefficientStorage< Complex<long double>, long double> nodeMajor(5, 4, pqBuses, pvBuses, admittances, CoefficientStorageLayoutNodeMajor);
+	CoefficientStorage< Complex<long double>, long double> stepMajor(5, 4, pqBuses, pvBuses, admittances, CoefficientStorageLayoutStepMajor);
+	Vector<long double, Complex<long double> > coefficients(4);
+
+	for (auto step = 0; step < 5; ++step)
+	{
+		for (auto i = 0; i < 4; ++i)
+			coefficients.set(i, Complex<long double>(1.0/(step + i + 1), 0.5*step - i));
+
+		nodeMajor.addCoefficients(coefficients);
+		stepMajor.addCoefficients(coefficients);
+	}
+
+	for (auto step = 0; step < 5; ++step)
+	{
+		for (auto i = 0; i < 4; ++i)
+			if (nodeMajor.getCoefficient(i, step) != stepMajor.getCoefficient(i, step))
+				return false;
+
+		for (auto i = 0; i < 2; ++i)
+		{
+			auto pqNode = pqBuses[i].getId();
+			auto pvNode = pvBuses[i].getId();
+
+			if (nodeMajor.getInverseCoefficient(pqNode, step) != stepMajor.getInverseCoefficient(pqNode, step))
+				return false;
+			if (nodeMajor.getSquaredCoefficient(pvNode, step) != stepMajor.getSquaredCoefficient(pvNode, step))
+				return false;
+			if (nodeMajor.getWeightedCoefficient(pvNode, step) != stepMajor.getWeightedCoefficient(pvNode, step))
+				return false;
+			if (nodeMajor.getCombinedCoefficient(pvNode, step) != stepMajor.getCombinedCoefficient(pvNode, step))
+				return false;
+		}
+	}
+
+	if (!areEqual(Complex<long double>(1, 0)/Complex<long double>(0.25, -3), nodeMajor.getInverseCoefficient(3, 0), 0.000001))
+		return false;
+
+	try
+	{
+		nodeMajor.addCoefficients(coefficients);
+	}
+	catch (range_error)
+	{
+		return nodeMajor.getCoefficientCount() == 5;
+	}
+
+	return false;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCoefficientStorageRelaxedConvolution()
+{
+	// long enough for squares of the relaxed convolution, which are multiplied with the method of Karatsuba
+	const int count = 130;
+	vector<PQBus> pqBuses;
+	pqBuses.push_back(PQBus(0, Complex<long double>()));
+	pqBuses.push_back(PQBus(2, Complex<long double>()));
+	vector<PVBus> pvBuses;
+	pvBuses.push_back(PVBus(1, 0, 1.05));
+	pvBuses.push_back(PVBus(3, 0, 0.95));
+	SparseMatrix<long double, Complex<long double> > admittances(4, 4);
+
+	for (auto i = 0; i < 4; ++i)
+	{
+		admittances.set(i, i, Complex<long double>(20 + i, 10));
+		admittances.set(i, (i + 1)%4, Complex<long double>(-10, i));
+		admittances.set((i + 1)%4, i, Complex<long double>(-10, -i));
+	}
+
+	CoefficientStorage< Complex<long double>, long double> nodeMajor(count, 4, pqBuses, pvBuses, admittances, CoefficientStorageLayoutNodeMajor);
+	CoefficientStorage< Complex<long double>, long double> stepMajor(count, 4, pqBuses, pvBuses, admittances, CoefficientStorageLayoutStepMajor);
+	Vector<long double, Complex<long double> > coefficients(4);
+	// decreasing as well as increasing magnitudes, like the coefficients of a holomorphic embedding inside and outside of the radius of convergence
+	long double const radii[] = { 0.5, 0.9, 1.2, 0.7 };
+
+	for (auto step = 0; step < count; ++step)
+	{
+		for (auto i = 0; i < 4; ++i)
+		{
+			auto magnitude = step == 0 ? 1 : pow(radii[i], step);
+			coefficients.set(i, Complex<long double>(magnitude*cos(0.7*step + i), magnitude*sin(1.3*step - i)));
+		}
+
+		nodeMajor.addCoefficients(coefficients);
+		stepMajor.addCoefficients(coefficients);
+	}
+
+	// the direct convolutions, compared relative to the sums of the absolute values of the products
+	for (auto n = 0; n < count; ++n)
+	{
+		for (auto bus = 0; bus < 2; ++bus)
+		{
+			auto pqNode = pqBuses[bus].getId();
+			auto pvNode = pvBuses[bus].getId();
+			Complex<long double> inverseSum;
+			Complex<long double> squaredSum;
+			Complex<long double> combinedSum(conj(admittances(pvNode, pvNode))*nodeMajor.getCoefficient(pvNode, n)*Complex<long double>(pvBuses[bus].getVoltageMagnitude()*pvBuses[bus].getVoltageMagnitude()));
+			long double inverseMagnitude = 0;
+			long double squaredMagnitude = 0;
+			long double combinedMagnitude = std::abs(combinedSum);
+
+			for (auto i = 0; i <= n; ++i)
+			{
+				inverseSum.addProduct(nodeMajor.getCoefficient(pqNode, i), nodeMajor.getInverseCoefficient(pqNode, n - i));
+				inverseMagnitude += std::abs(nodeMajor.getCoefficient(pqNode, i))*std::abs(nodeMajor.getInverseCoefficient(pqNode, n - i));
+				squaredSum.addProduct(nodeMajor.getCoefficient(pvNode, i), nodeMajor.getCoefficient(pvNode, n - i));
+				squaredMagnitude += std::abs(nodeMajor.getCoefficient(pvNode, i))*std::abs(nodeMajor.getCoefficient(pvNode, n - i));
+				combinedSum.addProduct(nodeMajor.getWeightedCoefficient(pvNode, i), nodeMajor.getSquaredCoefficient(pvNode, n - i));
+				combinedMagnitude += std::abs(nodeMajor.getWeightedCoefficient(pvNode, i))*std::abs(nodeMajor.getSquaredCoefficient(pvNode, n - i));
+			}
+
+			if (!areEqual(inverseSum, Complex<long double>(n == 0 ? 1 : 0, 0), 1e-14*inverseMagnitude))
+				return false;
+			if (!areEqual(squaredSum, nodeMajor.getSquaredCoefficient(pvNode, n), 1e-14*squaredMagnitude))
+				return false;
+			if (!areEqual(combinedSum, nodeMajor.getCombinedCoefficient(pvNode, n), 1e-14*combinedMagnitude))
+				return false;
+
+			if (nodeMajor.getInverseCoefficient(pqNode, n) != stepMajor.getInverseCoefficient(pqNode, n))
+				return false;
+			if (nodeMajor.getCombinedCoefficient(pvNode, n) != stepMajor.getCombinedCoefficient(pvNode, n))
+				return false;
+		}
+	}
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsRelaxedConvolutionDouble()
+{
+	// long enough for squares, which are multiplied with the method of Karatsuba
+	const int count = 150;
+	vector< Complex<double> > first(count);
+	vector< Complex<double> > second(count);
+
+	for (auto i = 0; i < count; ++i)
+	{
+		first[i] = Complex<double>(pow(0.9, i)*cos(0.7*i), pow(0.9, i)*sin(1.3*i));
+		second[i] = Complex<double>(pow(0.8, i)*sin(0.4*i + 1), pow(0.8, i)*cos(1.1*i));
+	}
+
+	RelaxedConvolution< Complex<double>, double > convolution(count, 1);
+	convolution.calculateNextCoefficient(0, 0, &first[0], 1, &second[0], 1);
+
+	for (auto step = 1; step < count; ++step)
+	{
+		auto result = convolution.calculateNextCoefficient(0, step, &first[0], 1, &second[0], 1);
+		Complex<long double> reference;
+		long double magnitude = 0;
+
+		for (auto i = 1; i <= step; ++i)
+		{
+			reference.addProduct(toLongDouble(first[i]), toLongDouble(second[step - i]));
+			magnitude += std::abs(toLongDouble(first[i]))*std::abs(toLongDouble(second[step - i]));
+		}
+
+		if (!areEqual(toLongDouble(result), reference, 1e-13*magnitude))
+			return false;
+	}
+
+	return true;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsAnalyticContinuationStepByStep()
 {
 	vector<PQBus> pqBuses;
@@ -420,6 +857,51 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsAnalyticContinuationBunchA
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsAnalyticContinuationViskovatov()
+{
+	vector<PQBus> pqBuses;
+	pqBuses.push_back(PQBus(0, Complex<long double>()));
+	vector<PVBus> pvBuses;
+	SparseMatrix<long double, Complex<long double> > admittances(1, 1);
+	CoefficientStorage< Complex<long double>, long double > coefficientStorage(6, 1, pqBuses, pvBuses, admittances);
+	AnalyticContinuationViskovatov< long double, Complex<long double> > continuation(coefficientStorage, 0, 6);
+	AnalyticContinuation< long double, Complex<long double> > epsilonAlgorithm(coefficientStorage, 0, 6);
+	Vector<long double, Complex<long double> > coefficients(1);
+	double const values[] = { 0.5, 0.0625, 0.01660156, 0.00473809, 0.00137754 };
+
+	for (auto i = 0; i < 5; ++i)
+	{
+		coefficients.set(0, Complex<long double>(values[i], 0));
+		coefficientStorage.addCoefficients(coefficients);
+		continuation.updateWithLastCoefficients();
+		epsilonAlgorithm.updateWithLastCoefficients();
+
+		// both calculate the diagonal Pade approximants, for an even number of coefficients the continued fraction has a higher order
+		if (i % 2 == 0 && !areEqual(epsilonAlgorithm.getResult(), continuation.getResult(), 0.0000001))
+			return false;
+	}
+
+	if (!areEqual(Complex<long double>(0.58578574861861932, 0), continuation.getResult(), 0.00001))
+		return false;
+
+	CoefficientStorage< Complex<long double>, long double > geometricSeries(6, 1, pqBuses, pvBuses, admittances);
+	AnalyticContinuationViskovatov< long double, Complex<long double> > geometricContinuation(geometricSeries, 0, 6);
+
+	for (auto i = 0; i < 6; ++i)
+	{
+		coefficients.set(0, Complex<long double>(pow(0.5, i), pow(0.5, i)));
+		geometricSeries.addCoefficients(coefficients);
+	}
+
+	geometricContinuation.updateWithCoefficients(2);
+
+	if (!areEqual(Complex<long double>(2, 2), geometricContinuation.getResult(), 0.0000001))
+		return false;
+
+	geometricContinuation.updateWithLastCoefficients();
+	return areEqual(Complex<long double>(2, 2), geometricContinuation.getResult(), 0.0000001);
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemOne()
 {
 	SparseMatrix<long double, Complex<long double>> A(3, 3);
@@ -702,32 +1184,407 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemSeven(
 	return error < 1e-4;
 }
 
-extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorConstructor()
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemRefactorization()
 {
-	Vector<long double, Complex<long double> > a(3);
+	auto n = 15025;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	LUDecompositionStable<long double, Complex<long double>> luSolver(A);
+	auto symbolic = luSolver.getSymbolic();
 
-	if (a.getCount() != 3)
-		return false;
+	for (auto row = 0; row < n; ++row)
+	{
+		x.set(row, Complex<long double>(row, 1));
+		auto factor = Complex<long double>(1.1, 0.1)*Complex<long double>(1 + (row % 3)*0.01, 0);
 
-	if (a(0) != Complex<long double>(0, 0))
-		return false;
+		for (auto iterator = A.getRowIterator(row); iterator.isValid(); iterator.next())
+			A.set(row, iterator.getColumn(), iterator.getValue()*factor);
+	}
 
-	if (a(1) != Complex<long double>(0, 0))
-		return false;
+	A.multiply(b, x);
+	LUDecompositionStable<long double, Complex<long double>> luSolverRefactorized(A, symbolic);
 
-	if (a(2) != Complex<long double>(0, 0))
+	if (!areEqual(x, luSolverRefactorized.solve(b), 1e-5))
 		return false;
 
-	return true;
+	for (auto i = 0; i < n; ++i)
+		A.set(i, i, A(i, i)*Complex<long double>(1.1, 0.1));
+
+	A.multiply(b, x);
+	luSolver.refactorize(A);
+	return areEqual(x, luSolver.solve(b), 1e-5);
 }
 
-extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorCopyConstructor()
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemRefactorizationWithDifferentPattern()
 {
-	Vector<long double, Complex<long double> > a(3);
-	a.set(0, Complex<long double>(1, 0));
-	a.set(1, Complex<long double>(2, 0));
-	a.set(2, Complex<long double>(3, 0));
-	Vector<long double, Complex<long double> > b(a);
+	SparseMatrix<long double, Complex<long double>> A(3, 3);
+	A.set(0, 0, Complex<long double>(1, 2));
+	A.set(0, 1, Complex<long double>(3, 4));
+	A.set(1, 1, Complex<long double>(7, 8));
+	A.set(2, 2, Complex<long double>(13, 14));
+	LUDecompositionStable<long double, Complex<long double>> luSolver(A);
+	A.set(0, 2, Complex<long double>(5, 6));
+	A.set(1, 2, Complex<long double>(9, 10));
+	A.set(2, 0, Complex<long double>(11, 12));
+	Vector<long double, Complex<long double> > x(3);
+	x.set(0, Complex<long double>(15, 16));
+	x.set(1, Complex<long double>(17, 18));
+	x.set(2, Complex<long double>(19, 20));
+	Vector<long double, Complex<long double> > b(3);
+	A.multiply(b, x);
+
+	LUDecompositionSparse<long double, Complex<long double>> luSolverRefactorized(A, luSolver.getSymbolic());
+	luSolver.refactorize(A);
+
+	if (!areEqual(x, luSolverRefactorized.solve(b), 0.000001))
+		return false;
+
+	return areEqual(x, luSolver.solve(b), 0.000001);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemMultipleRightHandSides()
+{
+	auto n = 15025;
+	auto count = 3;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	LUDecompositionStable<long double, Complex<long double>> luSolver(A);
+	vector<Vector<long double, Complex<long double>>> b(count, Vector<long double, Complex<long double>>(n));
+
+	for (auto k = 0; k < count; ++k)
+	{
+		Vector<long double, Complex<long double>> x(n);
+
+		for (auto i = 0; i < n; ++i)
+			x.set(i, Complex<long double>(i*(k + 1), k - i));
+
+		A.multiply(b[k], x);
+	}
+
+	auto results = luSolver.solveMultiple(b);
+
+	if (static_cast<int>(results.size()) != count)
+		return false;
+
+	for (auto k = 0; k < count; ++k)
+		if (!areEqual(luSolver.solve(b[k]), results[k], 1e-10))
+			return false;
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemLevels()
+{
+	SparseMatrix<long double, Complex<long double>> diagonal(4, 4);
+	SparseMatrix<long double, Complex<long double>> dense(3, 3);
+
+	for (auto i = 0; i < 4; ++i)
+		diagonal.set(i, i, Complex<long double>(i + 1, 1));
+
+	for (auto row = 0; row < 3; ++row)
+		for (auto column = 0; column < 3; ++column)
+			dense.set(row, column, Complex<long double>(row == column ? 10 : row + column + 1, row - column));
+
+	LUDecompositionStable<long double, Complex<long double>> diagonalSolver(diagonal);
+	LUDecompositionStable<long double, Complex<long double>> denseSolver(dense);
+
+	if (diagonalSolver.getForwardLevelCount() != 1 || diagonalSolver.getBackwardLevelCount() != 1)
+		return false;
+
+	if (denseSolver.getForwardLevelCount() != 3 || denseSolver.getBackwardLevelCount() != 3)
+		return false;
+
+	Vector<long double, Complex<long double>> x(3);
+	Vector<long double, Complex<long double>> b(3);
+	x.set(0, Complex<long double>(1, 2));
+	x.set(1, Complex<long double>(3, 4));
+	x.set(2, Complex<long double>(5, 6));
+	dense.multiply(b, x);
+
+	return areEqual(x, denseSolver.solve(b), 0.000001);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemPivotingWithFillIn()
+{
+	auto n = 6;
+	SparseMatrix<long double, Complex<long double>> arrow(n, n);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+
+	// the zero on the diagonal forces a row swap, after which the eliminations fill in the whole trailing matrix
+	for (auto i = 1; i < n; ++i)
+	{
+		arrow.set(0, i, Complex<long double>(1, i));
+		arrow.set(i, 0, Complex<long double>(i, -1));
+		arrow.set(i, i, Complex<long double>(i + 2, 1));
+	}
+
+	for (auto i = 0; i < n; ++i)
+		x.set(i, Complex<long double>(i + 1, n - i));
+
+	arrow.multiply(b, x);
+	LUDecompositionStable<long double, Complex<long double>> stableSolver(arrow);
+	LUDecompositionSparse<long double, Complex<long double>> sparseSolver(arrow);
+
+	return areEqual(x, stableSolver.solve(b), 0.000001) && areEqual(x, sparseSolver.solve(b), 0.000001);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsPreconditionerIncompleteLU()
+{
+	SparseMatrix<long double, Complex<long double>> tridiagonal(5, 5);
+	SparseMatrix<long double, Complex<long double>> dense(3, 3);
+
+	for (auto i = 0; i < 5; ++i)
+	{
+		tridiagonal.set(i, i, Complex<long double>(4, 1));
+
+		if (i > 0)
+			tridiagonal.set(i, i - 1, Complex<long double>(-1, 0));
+		if (i < 4)
+			tridiagonal.set(i, i + 1, Complex<long double>(-2, 1));
+	}
+
+	for (auto row = 0; row < 3; ++row)
+		for (auto column = 0; column < 3; ++column)
+			if (row + column != 3)
+				dense.set(row, column, Complex<long double>(row == column ? 10 : row + column + 1, row - column));
+
+	PreconditionerIncompleteLU<long double, Complex<long double>> tridiagonalPreconditioner(tridiagonal);
+	PreconditionerIncompleteLU<long double, Complex<long double>> densePreconditioner(dense);
+	PreconditionerIncompleteLU<long double, Complex<long double>> densePreconditionerThreshold(dense, 0, 3);
+
+	if (tridiagonalPreconditioner.getNonZeroCount() != 13 || tridiagonalPreconditioner.getForwardLevelCount() != 5 || tridiagonalPreconditioner.getBackwardLevelCount() != 5)
+		return false;
+
+	if (densePreconditioner.getNonZeroCount() != 7 || densePreconditionerThreshold.getNonZeroCount() != 9)
+		return false;
+
+	Vector<long double, Complex<long double>> x(5);
+	Vector<long double, Complex<long double>> b(5);
+	Vector<long double, Complex<long double>> result(5);
+
+	for (auto i = 0; i < 5; ++i)
+		x.set(i, Complex<long double>(i + 1, 2 - i));
+
+	tridiagonal.multiply(b, x);
+	tridiagonalPreconditioner.apply(result, b);
+
+	if (!areEqual(x, result, 0.000001))
+		return false;
+
+	Vector<long double, Complex<long double>> xDense(3);
+	Vector<long double, Complex<long double>> bDense(3);
+	Vector<long double, Complex<long double>> resultDense(3);
+	Vector<long double, Complex<long double>> resultDenseThreshold(3);
+	xDense.set(0, Complex<long double>(1, 2));
+	xDense.set(1, Complex<long double>(3, 4));
+	xDense.set(2, Complex<long double>(5, 6));
+	dense.multiply(bDense, xDense);
+	densePreconditioner.apply(resultDense, bDense);
+	densePreconditionerThreshold.apply(resultDenseThreshold, bDense);
+
+	return !areEqual(xDense, resultDense, 0.000001) && areEqual(xDense, resultDenseThreshold, 0.000001);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsBiCGSTABPreconditioners()
+{
+	auto width = 20;
+	auto n = width*width;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+
+	for (auto i = 0; i < n; ++i)
+	{
+		A.set(i, i, Complex<long double>(4.1, 0.5));
+
+		if (i % width > 0)
+			A.set(i, i - 1, Complex<long double>(-1, 0.1));
+		if (i % width < width - 1)
+			A.set(i, i + 1, Complex<long double>(-1, 0.1));
+		if (i >= width)
+			A.set(i, i - width, Complex<long double>(-1, 0.1));
+		if (i < n - width)
+			A.set(i, i + width, Complex<long double>(-1, 0.1));
+
+		x.set(i, Complex<long double>(i, n - i));
+	}
+
+	A.freeze();
+	A.multiply(b, x);
+	BiCGSTAB<long double, Complex<long double>> jacobiSolver(A, 1e-10, new PreconditionerJacobi<long double, Complex<long double>>(A));
+	BiCGSTAB<long double, Complex<long double>> incompleteLUSolver(A, 1e-10, new PreconditionerIncompleteLU<long double, Complex<long double>>(A));
+	BiCGSTAB<long double, Complex<long double>> incompleteLUThresholdSolver(A, 1e-10, new PreconditionerIncompleteLU<long double, Complex<long double>>(A, 1e-4, 5));
+	int jacobiIterations;
+	int incompleteLUIterations;
+	int incompleteLUThresholdIterations;
+
+	jacobiSolver.solve(b, jacobiIterations);
+	auto incompleteLUResult = incompleteLUSolver.solve(b, incompleteLUIterations);
+	auto incompleteLUThresholdResult = incompleteLUThresholdSolver.solve(b, incompleteLUThresholdIterations);
+
+	if (!areEqual(x, incompleteLUResult, 0.000001) || !areEqual(x, incompleteLUThresholdResult, 0.000001))
+		return false;
+
+	return incompleteLUThresholdIterations < incompleteLUIterations && incompleteLUIterations < jacobiIterations;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSolutionHistory()
+{
+	SparseMatrix<long double, Complex<long double>> A(5, 5);
+	vector<Vector<long double, Complex<long double>>> x(3, Vector<long double, Complex<long double>>(5));
+	vector<Vector<long double, Complex<long double>>> b(3, Vector<long double, Complex<long double>>(5));
+	Vector<long double, Complex<long double>> combinedRightHandSide(5);
+	Vector<long double, Complex<long double>> combinedSolution(5);
+	Vector<long double, Complex<long double>> dependentRightHandSide(5);
+	Vector<long double, Complex<long double>> dependentSolution(5);
+	SolutionHistory<long double, Complex<long double>> solutionHistory(5, 2);
+
+	for (auto i = 0; i < 5; ++i)
+	{
+		A.set(i, i, Complex<long double>(4, 1));
+
+		if (i > 0)
+			A.set(i, i - 1, Complex<long double>(-1, 0));
+		if (i < 4)
+			A.set(i, i + 1, Complex<long double>(-2, 1));
+
+		x[0].set(i, Complex<long double>(i + 1, 2 - i));
+		x[1].set(i, Complex<long double>(i*i, 1));
+		x[2].set(i, Complex<long double>(3 - i, i%2));
+	}
+
+	for (auto i = 0; i < 3; ++i)
+		A.multiply(b[i], x[i]);
+
+	if (!areEqual(Vector<long double, Complex<long double>>(5), solutionHistory.calculateInitialGuess(b[0]), 0.000001))
+		return false;
+
+	solutionHistory.add(b[0], x[0]);
+	solutionHistory.add(b[1], x[1]);
+	combinedRightHandSide.weightedSum(b[0], Complex<long double>(0, -3), b[1]);
+	combinedSolution.weightedSum(x[0], Complex<long double>(0, -3), x[1]);
+
+	if (!areEqual(combinedSolution, solutionHistory.calculateInitialGuess(combinedRightHandSide), 0.000001))
+		return false;
+
+	dependentRightHandSide.weightedSum(b[0], Complex<long double>(2, 0), b[1]);
+	dependentSolution.weightedSum(x[0], Complex<long double>(2, 0), x[1]);
+	solutionHistory.add(dependentRightHandSide, dependentSolution);
+
+	if (solutionHistory.getLength() != 2)
+		return false;
+
+	solutionHistory.add(b[2], x[2]);
+
+	return solutionHistory.getLength() == 2;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemWithoutAllocations()
+{
+	auto width = 10;
+	auto n = width*width;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	Vector<long double, Complex<long double>> x(n);
+	Vector<long double, Complex<long double>> b(n);
+	Vector<long double, Complex<long double>> previousX(n);
+	Vector<long double, Complex<long double>> previousB(n);
+	SolutionHistory<long double, Complex<long double>> solutionHistory(n, 2);
+
+	for (auto i = 0; i < n; ++i)
+	{
+		A.set(i, i, Complex<long double>(4.1, 0.5));
+
+		if (i % width > 0)
+			A.set(i, i - 1, Complex<long double>(-1, 0.1));
+		if (i % width < width - 1)
+			A.set(i, i + 1, Complex<long double>(-1, 0.1));
+		if (i >= width)
+			A.set(i, i - width, Complex<long double>(-1, 0.1));
+		if (i < n - width)
+			A.set(i, i + width, Complex<long double>(-1, 0.1));
+
+		x.set(i, Complex<long double>(i, n - i));
+		previousX.set(i, Complex<long double>(1, i));
+	}
+
+	A.freeze();
+	A.multiply(b, x);
+	A.multiply(previousB, previousX);
+	solutionHistory.add(previousB, previousX);
+	vector<Vector<long double, Complex<long double>>> bMultiple(2, b);
+	LUDecompositionStable<long double, Complex<long double>> luSolver(A);
+	BiCGSTAB<long double, Complex<long double>> jacobiSolver(A, 1e-10);
+	BiCGSTAB<long double, Complex<long double>> incompleteLUSolver(A, 1e-10, new PreconditionerIncompleteLU<long double, Complex<long double>>(A));
+	SOR<long double, Complex<long double>> sorSolver(A, 1e-10, 1, 10000);
+	vector<ILinearEquationSystemSolver<long double, Complex<long double>> const*> solvers;
+	solvers.push_back(&luSolver);
+	solvers.push_back(&jacobiSolver);
+	solvers.push_back(&incompleteLUSolver);
+	solvers.push_back(&sorSolver);
+	vector<Vector<long double, Complex<long double>>> results(solvers.size() + 1, Vector<long double, Complex<long double>>(n));
+	vector<Vector<long double, Complex<long double>>> resultsMultiple(2, Vector<long double, Complex<long double>>(n));
+
+	for (auto k = 0; k < 3; ++k)
+	{
+		// the first solves allocate the temporary values of the reductions
+		if (k == 1)
+			HeapAllocationCounter::start();
+
+		for (size_t i = 0; i < solvers.size(); ++i)
+			solvers[i]->solve(b, results[i]);
+
+		jacobiSolver.solveWithHistory(b, solutionHistory, results.back());
+		luSolver.solveMultiple(bMultiple, resultsMultiple);
+	}
+
+	auto allocationCount = HeapAllocationCounter::getCount();
+	HeapAllocationCounter::stop();
+
+	if (allocationCount != 0)
+		return false;
+
+	for (auto const &result : results)
+		if (!areEqual(x, result, 0.000001))
+			return false;
+
+	for (auto const &result : resultsMultiple)
+		if (!areEqual(x, result, 0.000001))
+			return false;
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorConstructor()
+{
+	Vector<long double, Complex<long double> > a(3);
+
+	if (a.getCount() != 3)
+		return false;
+
+	if (a(0) != Complex<long double>(0, 0))
+		return false;
+
+	if (a(1) != Complex<long double>(0, 0))
+		return false;
+
+	if (a(2) != Complex<long double>(0, 0))
+		return false;
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorCopyConstructor()
+{
+	Vector<long double, Complex<long double> > a(3);
+	a.set(0, Complex<long double>(1, 0));
+	a.set(1, Complex<long double>(2, 0));
+	a.set(2, Complex<long double>(3, 0));
+	Vector<long double, Complex<long double> > b(a);
 
 	if (b.getCount() != 3)
 		return false;
@@ -768,6 +1625,60 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorAssignment()
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorMove()
+{
+	Vector<long double, Complex<long double> > a(3);
+	a.set(0, Complex<long double>(1, 0));
+	a.set(1, Complex<long double>(2, 0));
+	a.set(2, Complex<long double>(3, 0));
+	Vector<long double, Complex<long double> > c(3);
+	c.set(0, Complex<long double>(4, 0));
+	vector<Vector<long double, Complex<long double> > > sources(10, Vector<long double, Complex<long double> >(3));
+	vector<Vector<long double, Complex<long double> > > vectors;
+
+	long long storageGrowths = 0;
+
+	HeapAllocationCounter::start();
+	Vector<long double, Complex<long double> > b(std::move(a));
+	c = std::move(b);
+
+	// the vectors have to be moved and not copied when the storage grows, therefore only the storage itself allocates
+	for (auto &source : sources)
+	{
+		auto capacity = vectors.capacity();
+		vectors.push_back(std::move(source));
+
+		if (vectors.capacity() != capacity)
+			++storageGrowths;
+	}
+
+	auto allocationCount = HeapAllocationCounter::getCount();
+	HeapAllocationCounter::stop();
+
+	if (allocationCount != storageGrowths)
+		return false;
+
+	if (a.getCount() != 0 || sources[0].getCount() != 0 || vectors.back().getCount() != 3)
+		return false;
+
+	if (b.getCount() != 3 || b(0) != Complex<long double>(4, 0))
+		return false;
+
+	if (c.getCount() != 3)
+		return false;
+
+	if (c(0) != Complex<long double>(1, 0))
+		return false;
+
+	if (c(1) != Complex<long double>(2, 0))
+		return false;
+
+	if (c(2) != Complex<long double>(3, 0))
+		return false;
+
+	return true;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorDotProduct()
 {
 	Vector<long double, Complex<long double> > a(3);
@@ -796,6 +1707,66 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorSquaredNorm()
 	return result == Complex<long double>(1*1 + 2*2 + 3*3, 0);
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSummation()
+{
+	SummationNaive<long double> naive;
+	SummationNeumaier<long double> neumaier;
+	SummationPairwise<long double> pairwise;
+	SummationSorted<long double> sorted;
+	long double const summands[] = { 1e20, 1, -1e20, 3, 2 };
+
+	for (auto summand : summands)
+	{
+		naive.add(summand);
+		neumaier.add(summand);
+		pairwise.add(summand);
+		sorted.add(summand);
+	}
+
+	if (naive.getResult() != 5)
+		return false;
+
+	if (neumaier.getResult() != 6)
+		return false;
+
+	naive.reset();
+	neumaier.reset();
+	pairwise.reset();
+	sorted.reset();
+
+	for (auto i = 1; i <= 100; ++i)
+	{
+		naive.add(i);
+		neumaier.add(i);
+		pairwise.add(i);
+		sorted.add(i);
+	}
+
+	return	naive.getResult() == 5050 && neumaier.getResult() == 5050 &&
+			pairwise.getResult() == 5050 && sorted.getResult() == 5050;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorDotProductWithSummation()
+{
+	Vector<long double, Complex<long double> > a(3);
+	a.set(0, Complex<long double>(1e20, 0));
+	a.set(1, Complex<long double>(1, 2));
+	a.set(2, Complex<long double>(-1e20, 0));
+	Vector<long double, Complex<long double> > b(3);
+	b.set(0, Complex<long double>(1, 0));
+	b.set(1, Complex<long double>(1, 0));
+	b.set(2, Complex<long double>(1, 0));
+
+	auto naive = a.dot<SummationNaive<long double>>(b);
+	auto neumaier = a.dot<SummationNeumaier<long double>>(b);
+	auto pairwise = a.dot<SummationPairwise<long double>>(b);
+	auto sorted = a.dot<SummationSorted<long double>>(b);
+	auto standard = a.dot(b);
+
+	return	naive == Complex<long double>(0, 2) && neumaier == Complex<long double>(1, 2) &&
+			pairwise == Complex<long double>(0, 2) && sorted == Complex<long double>(0, 2) && standard == neumaier;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorWeightedSum()
 {
 	Vector<long double, Complex<long double> > a(3);
@@ -948,6 +1919,29 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorConjugate()
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorPermutate()
+{
+	vector<int> permutation;
+	permutation.push_back(2);
+	permutation.push_back(0);
+	permutation.push_back(3);
+	permutation.push_back(1);
+	Vector<long double, Complex<long double> > x(4);
+	Vector<long double, Complex<long double> > permutated(4);
+	Vector<long double, Complex<long double> > restored(4);
+	Vector<long double, Complex<long double> > multiplied(4);
+	SparseMatrix<long double, Complex<long double> > P(permutation);
+
+	for (auto i = 0; i < 4; ++i)
+		x.set(i, Complex<long double>(i + 1, -i));
+
+	permutated.permutate(x, permutation);
+	restored.permutateInverse(permutated, permutation);
+	P.multiply(multiplied, x);
+
+	return permutated == multiplied && restored == x;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorMultiPrecision()
 {
 	MultiPrecision::setDefaultPrecision(100);
@@ -964,31 +1958,111 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorMultiPrecision()
 	return true;
 }
 
-extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixConstructor()
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorMoveMultiPrecision()
 {
-	SparseMatrix<long double, Complex<long double> > matrix(4, 5);
+	MultiPrecision::setDefaultPrecision(100);
+	Vector<MultiPrecision, Complex<MultiPrecision> > a(2);
+	Vector<MultiPrecision, Complex<MultiPrecision> > c(2);
+	a.set(0, Complex<MultiPrecision>(MultiPrecision(5), MultiPrecision(6)));
+	a.set(1, Complex<MultiPrecision>(MultiPrecision(7), MultiPrecision(8)));
 
-	if (matrix.getRowCount() != 4)
-		return false;
+	MultiPrecision::startAllocationCounting();
+	Vector<MultiPrecision, Complex<MultiPrecision> > b(std::move(a));
+	c(0) = std::move(b(0));
+	c(1) = std::move(b(1));
+	auto allocationCount = MultiPrecision::getAllocationCount();
+	MultiPrecision::stopAllocationCounting();
 
-	if (matrix.getColumnCount() != 5)
+	if (allocationCount != 0)
 		return false;
 
-	auto value = matrix(0, 0);
-	if (value != Complex<long double>(0, 0))
+	if (static_cast<double>(c(0).real()) != 5 || static_cast<double>(c(0).imag()) != 6)
 		return false;
 
-	value = matrix(1, 2);
-	if (value != Complex<long double>(0, 0))
+	if (static_cast<double>(c(1).real()) != 7 || static_cast<double>(c(1).imag()) != 8)
 		return false;
 
-	value = matrix(3, 4);
-	if (value != Complex<long double>(0, 0))
-		return false;
+	return true;
+}
 
-	auto n = 5;
-	vector<int> permutation;
-	permutation.push_back(4);
+extern "C" __declspec(dllexport) bool __cdecl RunTestsVectorDouble()
+{
+	// an odd size for the remainders of the vectorized kernels, and one with several blocks
+	int const counts[] = { 37, 2501 };
+	Complex<double> const xWeight(0.75, -1.5);
+	Complex<double> const yWeight(-2.25, 0.5);
+
+	for (auto count : counts)
+	{
+		Vector<double, Complex<double> > a(count);
+		Vector<double, Complex<double> > b(count);
+		Vector<double, Complex<double> > result(count);
+		Vector<long double, Complex<long double> > aReference(count);
+		Vector<long double, Complex<long double> > bReference(count);
+		Vector<long double, Complex<long double> > resultReference(count);
+
+		for (auto i = 0; i < count; ++i)
+		{
+			a.set(i, createDoubleTestValue(i, 0));
+			b.set(i, createDoubleTestValue(i, 1));
+			result.set(i, createDoubleTestValue(i, 2));
+			aReference.set(i, toLongDouble(a(i)));
+			bReference.set(i, toLongDouble(b(i)));
+			resultReference.set(i, toLongDouble(result(i)));
+		}
+
+		if (!areEqual(toLongDouble(a.dot(b)), aReference.dot(bReference), 1e-12))
+			return false;
+
+		if (!areEqual(toLongDouble(a.conjugateDot(b)), aReference.conjugateDot(bReference), 1e-12))
+			return false;
+
+		if (!areEqual(toLongDouble(a.squaredNorm()), aReference.squaredNorm(), 1e-12))
+			return false;
+
+		result.addWeightedSum(xWeight, a, yWeight, b);
+		resultReference.addWeightedSum(toLongDouble(xWeight), aReference, toLongDouble(yWeight), bReference);
+
+		for (auto i = 0; i < count; ++i)
+			if (!areEqual(toLongDouble(result(i)), resultReference(i), 1e-14))
+				return false;
+
+		result.weightedSum(a, yWeight, b);
+		resultReference.weightedSum(aReference, toLongDouble(yWeight), bReference);
+
+		for (auto i = 0; i < count; ++i)
+			if (!areEqual(toLongDouble(result(i)), resultReference(i), 1e-14))
+				return false;
+	}
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixConstructor()
+{
+	SparseMatrix<long double, Complex<long double> > matrix(4, 5);
+
+	if (matrix.getRowCount() != 4)
+		return false;
+
+	if (matrix.getColumnCount() != 5)
+		return false;
+
+	auto value = matrix(0, 0);
+	if (value != Complex<long double>(0, 0))
+		return false;
+
+	value = matrix(1, 2);
+	if (value != Complex<long double>(0, 0))
+		return false;
+
+	value = matrix(3, 4);
+	if (value != Complex<long double>(0, 0))
+		return false;
+
+	auto n = 5;
+	vector<int> permutation;
+	permutation.push_back(4);
 	permutation.push_back(2);
 	permutation.push_back(0);
 	permutation.push_back(3);
@@ -1232,6 +2306,50 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixMultiply()
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixMultiplyDouble()
+{
+	const int rowCount = 23;
+	const int columnCount = 41;
+	SparseMatrix<double, Complex<double> > matrix(rowCount, columnCount);
+	SparseMatrix<long double, Complex<long double> > matrixReference(rowCount, columnCount);
+	Vector<double, Complex<double> > source(columnCount);
+	Vector<long double, Complex<long double> > sourceReference(columnCount);
+	Vector<double, Complex<double> > result(rowCount);
+	Vector<long double, Complex<long double> > resultReference(rowCount);
+
+	// rows with zero, one and up to nine elements, to reach the remainders of the vectorized kernel
+	for (auto row = 0; row < rowCount; ++row)
+		for (auto column = row%3; column < columnCount; column += 1 + row%5)
+			if (column*row%10 < 9 - row%10)
+			{
+				matrix.set(row, column, createDoubleTestValue(row*columnCount + column, 0));
+				matrixReference.set(row, column, toLongDouble(matrix(row, column)));
+			}
+
+	for (auto i = 0; i < columnCount; ++i)
+	{
+		source.set(i, createDoubleTestValue(i, 1));
+		sourceReference.set(i, toLongDouble(source(i)));
+	}
+
+	matrix.multiply(result, source);
+	matrixReference.multiply(resultReference, sourceReference);
+
+	for (auto row = 0; row < rowCount; ++row)
+	{
+		if (!areEqual(toLongDouble(result(row)), resultReference(row), 1e-13))
+			return false;
+
+		if (!areEqual(toLongDouble(matrix.multiplyRowWithStartColumn(row, source, 7)), matrixReference.multiplyRowWithStartColumn(row, sourceReference, 7), 1e-13))
+			return false;
+
+		if (!areEqual(toLongDouble(matrix.multiplyRowWithEndColumn(row, source, 30)), matrixReference.multiplyRowWithEndColumn(row, sourceReference, 30), 1e-13))
+			return false;
+	}
+
+	return true;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixRowIteration()
 {
 	SparseMatrix<long double, Complex<long double> > matrix(3, 4);
@@ -1448,6 +2566,42 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixAssignment()
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixMove()
+{
+	SparseMatrix<long double, Complex<long double> > matrix(3, 3);
+	SparseMatrix<long double, Complex<long double> > other(3, 3);
+	matrix.set(0, 0, Complex<long double>(4, 0));
+	matrix.set(1, 2, Complex<long double>(10, 0));
+	matrix.set(2, 1, Complex<long double>(6, 0));
+	matrix.freeze();
+	other.set(1, 1, Complex<long double>(11, 0));
+
+	SparseMatrix<long double, Complex<long double> > moved(std::move(matrix));
+
+	if (matrix.getNonZeroCount() != 0 || matrix.isFrozen())
+		return false;
+
+	if (!moved.isFrozen() || moved.getNonZeroCount() != 3)
+		return false;
+
+	if (moved(0, 0) != Complex<long double>(4, 0) || moved(1, 2) != Complex<long double>(10, 0) || moved(2, 1) != Complex<long double>(6, 0))
+		return false;
+
+	other = std::move(moved);
+
+	if (!other.isFrozen() || other.getNonZeroCount() != 3)
+		return false;
+
+	if (other(0, 0) != Complex<long double>(4, 0) || other(1, 2) != Complex<long double>(10, 0) || other(2, 1) != Complex<long double>(6, 0))
+		return false;
+
+	if (moved.isFrozen() || moved(1, 1) != Complex<long double>(11, 0))
+		return false;
+
+	matrix.set(1, 1, Complex<long double>(1, 0));
+	return matrix.getNonZeroCount() == 1;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixGetRowValuesAndColumns()
 {
 	SparseMatrix<long double, Complex<long double> > matrix(3, 5);
@@ -1605,6 +2759,109 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixMultiplyWithSt
 	return true;
 }
 
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixFreeze()
+{
+	SparseMatrix<long double, Complex<long double> > matrix(4, 5);
+	matrix.set(0, 1, Complex<long double>(2, 0));
+	matrix.set(0, 2, Complex<long double>(3, 0));
+	matrix.set(0, 3, Complex<long double>(4, 0));
+	matrix.set(1, 0, Complex<long double>(5, 0));
+	matrix.set(1, 3, Complex<long double>(60, 0));
+	matrix.set(3, 2, Complex<long double>(7, 0));
+	matrix.set(3, 0, Complex<long double>(80, 0));
+	auto matrixFrozen = matrix;
+	matrixFrozen.freeze();
+	Vector<long double, Complex<long double> > source(5);
+	Vector<long double, Complex<long double> > result(4);
+	Vector<long double, Complex<long double> > resultFrozen(4);
+	source.set(0, Complex<long double>(1, 0));
+	source.set(1, Complex<long double>(2, 0));
+	source.set(2, Complex<long double>(3, 0));
+	source.set(3, Complex<long double>(4, 0));
+	source.set(4, Complex<long double>(5, 0));
+
+	if (matrix.isFrozen() || !matrixFrozen.isFrozen())
+		return false;
+
+	if (matrixFrozen.getNonZeroCount() != 7 || matrix.getNonZeroCount() != 7)
+		return false;
+
+	if (!(matrix == matrixFrozen))
+		return false;
+
+	for (auto row = 0; row < 4; ++row)
+		for (auto column = 0; column < 5; ++column)
+			if (matrix(row, column) != matrixFrozen(row, column))
+				return false;
+
+	matrix.multiply(result, source);
+	matrixFrozen.multiply(resultFrozen, source);
+
+	if (!areEqual(result, resultFrozen, 0.000001))
+		return false;
+
+	if (matrix.multiplyRowWithStartColumn(0, source, 2) != matrixFrozen.multiplyRowWithStartColumn(0, source, 2))
+		return false;
+
+	if (matrix.multiplyRowWithEndColumn(1, source, 2) != matrixFrozen.multiplyRowWithEndColumn(1, source, 2))
+		return false;
+
+	auto emptyRowIterator = matrixFrozen.getRowIterator(2);
+
+	if (emptyRowIterator.isValid() || emptyRowIterator.getNonZeroCount() != 0)
+		return false;
+
+	auto iterator = matrixFrozen.getRowIterator(3, 1);
+
+	if (!iterator.isValid() || iterator.getColumn() != 2 || iterator.getValue() != Complex<long double>(7, 0))
+		return false;
+
+	matrixFrozen.unfreeze();
+
+	if (matrixFrozen.isFrozen() || !(matrix == matrixFrozen))
+		return false;
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsSparseMatrixSetWhileFrozen()
+{
+	SparseMatrix<long double, Complex<long double> > matrix(3, 3);
+	matrix.set(0, 0, Complex<long double>(1, 0));
+	matrix.set(1, 2, Complex<long double>(2, 0));
+	matrix.set(2, 1, Complex<long double>(3, 0));
+	matrix.freeze();
+
+	matrix.set(1, 2, Complex<long double>(4, 0));
+
+	if (matrix(1, 2) != Complex<long double>(4, 0))
+		return false;
+
+	try
+	{
+		matrix.set(1, 1, Complex<long double>(5, 0));
+		return false;
+	}
+	catch (std::logic_error const &)
+	{ }
+
+	try
+	{
+		matrix.swapRows(0, 1);
+		return false;
+	}
+	catch (std::logic_error const &)
+	{ }
+
+	matrix.unfreeze();
+	matrix.set(1, 1, Complex<long double>(5, 0));
+
+	if (matrix(1, 1) != Complex<long double>(5, 0) || matrix(1, 2) != Complex<long double>(4, 0))
+		return false;
+
+	return true;
+}
+
 extern "C" __declspec(dllexport) bool __cdecl RunTestsGraphCalculateReverseCuthillMcKee()
 {
 	Graph graphOne;
@@ -1822,4 +3079,774 @@ extern "C" __declspec(dllexport) bool __cdecl RunTestsGraphFindPseudoPeriphereNo
 	auto result = graph->findPseudoPeriphereNode(eccentricity);
 
 	return eccentricity >= 190;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsGraphCalculateMinimumDegreeOrdering()
+{
+	Graph graph;
+
+	for (auto i = 1; i <= 6; ++i)
+		graph.addNode(i);
+
+	graph.connect(1, 1);
+	graph.connect(1, 2);
+	graph.connect(1, 3);
+	graph.connect(1, 4);
+	graph.connect(1, 5);
+	graph.connect(5, 6);
+
+	auto result = graph.calculateMinimumDegreeOrdering();
+
+	if (result.size() != 6)
+		return false;
+
+	auto sorted = result;
+	sort(sorted.begin(), sorted.end());
+
+	for (auto i = 0; i < 6; ++i)
+		if (sorted[i] != i + 1)
+			return false;
+
+	if (result[0] != 2 || result[1] != 3 || result[2] != 4)
+		return false;
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsLinearEquationSystemMinimumDegree()
+{
+	auto n = 15025;
+	auto m = 2000;
+	SparseMatrix<long double, Complex<long double>> A(n, n);
+	Vector<long double, Complex<long double>> x(m);
+	Vector<long double, Complex<long double>> b(m);
+	fstream file("testdata\\matrix.csv", ios_base::in);
+	file >> A;
+	auto AReduced = A.createReducedMatrix(m, m);
+
+	for (auto i = 0; i < m; ++i)
+		x.set(i, Complex<long double>(i + 1));
+
+	AReduced.multiply(b, x);
+	LUDecompositionSparse<long double, Complex<long double>> luSolverBandwidth(AReduced, LUDecompositionOrderingReverseCuthillMcKee);
+	LUDecompositionSparse<long double, Complex<long double>> luSolverFillIn(AReduced, LUDecompositionOrderingMinimumDegree);
+	LUDecompositionStable<long double, Complex<long double>> luSolverStable(AReduced, LUDecompositionOrderingMinimumDegree);
+
+	if (luSolverFillIn.getNonZeroCount() > luSolverBandwidth.getNonZeroCount())
+		return false;
+
+	if (!areEqual(x, luSolverBandwidth.solve(b), 1e-5))
+		return false;
+
+	if (!areEqual(x, luSolverFillIn.solve(b), 1e-5))
+		return false;
+
+	return areEqual(x, luSolverStable.solve(b), 1e-5);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorBulkInterface()
+{
+	int const rows[] = { 0, 0, 1, 1, 1, 2, 2 };
+	int const columns[] = { 0, 1, 0, 1, 2, 1, 2 };
+	int const rowPointers[] = { 0, 2, 5, 7 };
+	double const admittancesReal[] = { 20, -10, -10, 20, -10, -10, 10 };
+	double const admittancesImaginary[] = { -20, 10, 10, -20, 10, 10, -10 };
+	double const rowSumsReal[] = { 0, 0, 0 };
+	double const rowSumsImaginary[] = { 0, 0, 0 };
+	double const constantCurrentsReal[] = { 10, 0, 0 };
+	double const constantCurrentsImaginary[] = { -10, 0, 0 };
+	int const pqNodes[] = { 0, 1, 2 };
+	double const pqPowersReal[] = { 0, -0.5, -0.3 };
+	double const pqPowersImaginary[] = { 0, -0.1, -0.2 };
+	CalculatorLongDouble elementWise(0.00001, 30, 3, 3, 0, 1, false);
+	CalculatorLongDouble coordinates(0.00001, 30, 3, 3, 0, 1, false);
+	CalculatorLongDouble compressed(0.00001, 30, 3, 3, 0, 1, false);
+
+	for (auto i = 0; i < 7; ++i)
+		elementWise.setAdmittance(rows[i], columns[i], Complex<long double>(admittancesReal[i], admittancesImaginary[i]));
+
+	for (auto i = 0; i < 3; ++i)
+	{
+		elementWise.setAdmittanceRowSum(i, Complex<long double>(rowSumsReal[i], rowSumsImaginary[i]));
+		elementWise.setConstantCurrent(i, Complex<long double>(constantCurrentsReal[i], constantCurrentsImaginary[i]));
+	}
+
+	for (auto i = 0; i < 3; ++i)
+		elementWise.setPQBus(i, pqNodes[i], Complex<long double>(pqPowersReal[i], pqPowersImaginary[i]));
+
+	coordinates.setAdmittances(7, rows, columns, admittancesReal, admittancesImaginary);
+	compressed.setAdmittancesCompressed(rowPointers, columns, admittancesReal, admittancesImaginary);
+
+	for (ICalculator *calculator : { static_cast<ICalculator*>(&coordinates), static_cast<ICalculator*>(&compressed) })
+	{
+		calculator->setAdmittanceRowSums(rowSumsReal, rowSumsImaginary);
+		calculator->setConstantCurrents(constantCurrentsReal, constantCurrentsImaginary);
+		calculator->setPQBuses(pqNodes, pqPowersReal, pqPowersImaginary);
+	}
+
+	elementWise.calculate();
+	coordinates.calculate();
+	compressed.calculate();
+
+	for (ICalculator *calculator : { static_cast<ICalculator*>(&coordinates), static_cast<ICalculator*>(&compressed) })
+	{
+		double voltagesReal[3];
+		double voltagesImaginary[3];
+		double coefficientsReal[3];
+		double coefficientsImaginary[3];
+		calculator->getVoltages(voltagesReal, voltagesImaginary);
+		calculator->getCoefficients(1, coefficientsReal, coefficientsImaginary);
+
+		for (auto i = 0; i < 3; ++i)
+		{
+			if (voltagesReal[i] != elementWise.getVoltageReal(i) || voltagesImaginary[i] != elementWise.getVoltageImaginary(i))
+				return false;
+
+			if (coefficientsReal[i] != elementWise.getCoefficientReal(1, i) || coefficientsImaginary[i] != elementWise.getCoefficientImaginary(1, i))
+				return false;
+
+			if (abs(voltagesReal[i] - 1) > 0.2)
+				return false;
+		}
+	}
+
+	return true;
+}
+
+void setUpThreeNodeCalculator(ICalculator &calculator)
+{
+	int const rows[] = { 0, 0, 1, 1, 1, 2, 2 };
+	int const columns[] = { 0, 1, 0, 1, 2, 1, 2 };
+	double const admittancesReal[] = { 20, -10, -10, 20, -10, -10, 10 };
+	double const admittancesImaginary[] = { -20, 10, 10, -20, 10, 10, -10 };
+	double const zeros[] = { 0, 0, 0 };
+	double const constantCurrentsReal[] = { 10, 0, 0 };
+	double const constantCurrentsImaginary[] = { -10, 0, 0 };
+	int const pqNodes[] = { 0, 1, 2 };
+	double const pqPowersReal[] = { 0, -0.5, -0.3 };
+	double const pqPowersImaginary[] = { 0, -0.1, -0.2 };
+	calculator.setAdmittances(7, rows, columns, admittancesReal, admittancesImaginary);
+	calculator.setAdmittanceRowSums(zeros, zeros);
+	calculator.setConstantCurrents(constantCurrentsReal, constantCurrentsImaginary);
+	calculator.setPQBuses(pqNodes, pqPowersReal, pqPowersImaginary);
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorEarlyTermination()
+{
+	CalculatorLongDouble calculator(0.00001, 80, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(calculator);
+
+	calculator.calculate();
+
+	if (calculator.getCoefficientCount() >= 80)
+		return false;
+
+	if (calculator.getMaximumPossibleCoefficientCount() >= 0)
+		return false;
+
+	return calculator.getRelativePowerError() <= 0.00001 && calculator.getProgress() == 1;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorStallDetection()
+{
+	CalculatorLongDouble calculator(0, 80, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(calculator);
+
+	calculator.calculate();
+
+	if (calculator.getCoefficientCount() >= 80)
+		return false;
+
+	return calculator.getRelativePowerError() < 1e-10;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorSolutionHistory()
+{
+	CalculatorLongDouble withoutHistory(0.00001, 40, 3, 3, 0, 1, true);
+	CalculatorLongDouble withHistory(0.00001, 40, 3, 3, 0, 1, true);
+	setUpThreeNodeCalculator(withoutHistory);
+	setUpThreeNodeCalculator(withHistory);
+	withoutHistory.setSolutionHistoryLength(0);
+	withHistory.setSolutionHistoryLength(4);
+
+	withoutHistory.calculate();
+	withHistory.calculate();
+
+	if (withHistory.getRelativePowerError() > 0.00001)
+		return false;
+
+	for (auto i = 0; i < 3; ++i)
+		if (!areEqual(Complex<long double>(withoutHistory.getVoltageReal(i), withoutHistory.getVoltageImaginary(i)), Complex<long double>(withHistory.getVoltageReal(i), withHistory.getVoltageImaginary(i)), 0.000001))
+			return false;
+
+	try
+	{
+		withHistory.setSolutionHistoryLength(-1);
+	}
+	catch(invalid_argument)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorIterativeSolverTolerance()
+{
+	CalculatorLongDouble reference(0.00001, 40, 3, 3, 0, 1, true);
+	CalculatorLongDouble earlyStop(0.00001, 40, 3, 3, 0, 1, true);
+	setUpThreeNodeCalculator(reference);
+	setUpThreeNodeCalculator(earlyStop);
+	earlyStop.setIterativeSolverTolerance(0.00001*1e-10);
+
+	reference.calculate();
+	earlyStop.calculate();
+
+	if (earlyStop.getRelativePowerError() > 0.00001)
+		return false;
+
+	for (auto i = 0; i < 3; ++i)
+		if (!areEqual(Complex<long double>(reference.getVoltageReal(i), reference.getVoltageImaginary(i)), Complex<long double>(earlyStop.getVoltageReal(i), earlyStop.getVoltageImaginary(i)), 0.00001))
+			return false;
+
+	try
+	{
+		earlyStop.setIterativeSolverTolerance(-1);
+	}
+	catch(invalid_argument)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+vector<long long> allocationCountsOfSteps;
+
+void __stdcall storeAllocationCount(int calculator, double progress, double relativePowerError)
+{
+	allocationCountsOfSteps.push_back(HeapAllocationCounter::getCount());
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorCoefficientsWithoutAllocations()
+{
+	// without a solution history the right hand sides of all scenarios are solved together
+	for (auto variant = 0; variant < 4; ++variant)
+	{
+		CalculatorLongDouble calculator(0, 20, 3, 3, 0, 1, variant%2 == 1);
+		setUpThreeNodeCalculator(calculator);
+		calculator.setSolutionHistoryLength(variant < 2 ? 2 : 0);
+		calculator.setProgressCallback(storeAllocationCount, 0);
+		allocationCountsOfSteps.clear();
+		allocationCountsOfSteps.reserve(20);
+
+		HeapAllocationCounter::start();
+		calculator.calculate();
+		HeapAllocationCounter::stop();
+
+		// the first two coefficients are calculated before the loop, which allocates its workspaces during the first step
+		if (calculator.getCoefficientCount() != 20 || allocationCountsOfSteps.size() != 20)
+			return false;
+
+		for (size_t i = 3; i < allocationCountsOfSteps.size(); ++i)
+			if (allocationCountsOfSteps[i] != allocationCountsOfSteps[2])
+				return false;
+	}
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorErrorHistory()
+{
+	CalculatorLongDouble calculator(0, 20, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(calculator);
+
+	calculator.calculate();
+
+	auto count = calculator.getErrorHistoryCount();
+	vector<double> errors(count);
+	calculator.getErrorHistory(errors.data());
+
+	if (count != calculator.getCoefficientCount() - 2)
+		return false;
+
+	auto bestError = *min_element(errors.begin(), errors.end());
+
+	if (calculator.getRelativePowerError() != bestError)
+		return false;
+
+	calculator.calculate();
+	return calculator.getErrorHistoryCount() == count;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorBatch()
+{
+	auto scenarioCount = 3;
+	double const factors[] = { 1, 0.5, 1.5 };
+	int const pqNodes[] = { 0, 1, 2 };
+	CalculatorLongDouble batchCalculator(0.00001, 40, 3, 3, 0, 1, scenarioCount, false);
+	setUpThreeNodeCalculator(batchCalculator);
+
+	for (auto scenario = 0; scenario < scenarioCount; ++scenario)
+	{
+		double const pqPowersReal[] = { 0, -0.5*factors[scenario], -0.3*factors[scenario] };
+		double const pqPowersImaginary[] = { 0, -0.1*factors[scenario], -0.2*factors[scenario] };
+		batchCalculator.setPQBusesOfScenario(scenario, pqNodes, pqPowersReal, pqPowersImaginary);
+	}
+
+	batchCalculator.calculate();
+
+	if (batchCalculator.getScenarioCount() != scenarioCount || batchCalculator.getProgress() != 1)
+		return false;
+
+	for (auto scenario = 0; scenario < scenarioCount; ++scenario)
+	{
+		double const pqPowersReal[] = { 0, -0.5*factors[scenario], -0.3*factors[scenario] };
+		double const pqPowersImaginary[] = { 0, -0.1*factors[scenario], -0.2*factors[scenario] };
+		CalculatorLongDouble calculator(0.00001, 40, 3, 3, 0, 1, false);
+		setUpThreeNodeCalculator(calculator);
+		calculator.setPQBuses(pqNodes, pqPowersReal, pqPowersImaginary);
+		calculator.calculate();
+
+		double batchReal[3];
+		double batchImaginary[3];
+		double singleReal[3];
+		double singleImaginary[3];
+		batchCalculator.getVoltagesOfScenario(scenario, batchReal, batchImaginary);
+		calculator.getVoltages(singleReal, singleImaginary);
+
+		for (auto i = 0; i < 3; ++i)
+			if (abs(batchReal[i] - singleReal[i]) > 1e-10 || abs(batchImaginary[i] - singleImaginary[i]) > 1e-10)
+				return false;
+	}
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorBatchWithDifferentBuses()
+{
+	int const pqNodes[] = { 2, 1, 0 };
+	double const pqPowers[] = { 0, 0, 0 };
+	CalculatorLongDouble calculator(0.00001, 40, 3, 3, 0, 1, 2, false);
+	setUpThreeNodeCalculator(calculator);
+	calculator.setPQBusesOfScenario(1, pqNodes, pqPowers, pqPowers);
+
+	try
+	{
+		calculator.calculate();
+	}
+	catch(invalid_argument)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorExtendedPrecision()
+{
+	CalculatorLongDouble reference(0.00001, 40, 3, 3, 0, 1, false);
+	CalculatorDoubleDouble doubleDouble(0.00001, 40, 3, 3, 0, 1, false);
+	CalculatorQuadDouble quadDouble(0.00001, 40, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(reference);
+	setUpThreeNodeCalculator(doubleDouble);
+	setUpThreeNodeCalculator(quadDouble);
+
+	reference.calculate();
+	doubleDouble.calculate();
+	quadDouble.calculate();
+
+	if (doubleDouble.getProgress() != 1 || quadDouble.getProgress() != 1)
+		return false;
+
+	double referenceReal[3];
+	double referenceImaginary[3];
+	double doubleDoubleReal[3];
+	double doubleDoubleImaginary[3];
+	double quadDoubleReal[3];
+	double quadDoubleImaginary[3];
+	reference.getVoltages(referenceReal, referenceImaginary);
+	doubleDouble.getVoltages(doubleDoubleReal, doubleDoubleImaginary);
+	quadDouble.getVoltages(quadDoubleReal, quadDoubleImaginary);
+
+	for (auto i = 0; i < 3; ++i)
+	{
+		if (abs(referenceReal[i] - doubleDoubleReal[i]) > 1e-6 || abs(referenceImaginary[i] - doubleDoubleImaginary[i]) > 1e-6)
+			return false;
+
+		if (abs(referenceReal[i] - quadDoubleReal[i]) > 1e-6 || abs(referenceImaginary[i] - quadDoubleImaginary[i]) > 1e-6)
+			return false;
+	}
+
+	return true;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorDouble()
+{
+	CalculatorLongDouble reference(0.00001, 40, 3, 3, 0, 1, false);
+	CalculatorDouble calculator(0.00001, 40, 3, 3, 0, 1, false);
+	CalculatorDouble iterativeCalculator(0.00001, 40, 3, 3, 0, 1, true);
+	setUpThreeNodeCalculator(reference);
+	setUpThreeNodeCalculator(calculator);
+	setUpThreeNodeCalculator(iterativeCalculator);
+
+	reference.calculate();
+	calculator.calculate();
+	iterativeCalculator.calculate();
+
+	if (calculator.getProgress() != 1 || iterativeCalculator.getProgress() != 1)
+		return false;
+
+	double referenceReal[3];
+	double referenceImaginary[3];
+	double voltagesReal[3];
+	double voltagesImaginary[3];
+	double iterativeVoltagesReal[3];
+	double iterativeVoltagesImaginary[3];
+	reference.getVoltages(referenceReal, referenceImaginary);
+	calculator.getVoltages(voltagesReal, voltagesImaginary);
+	iterativeCalculator.getVoltages(iterativeVoltagesReal, iterativeVoltagesImaginary);
+
+	for (auto i = 0; i < 3; ++i)
+	{
+		if (abs(referenceReal[i] - voltagesReal[i]) > 1e-6 || abs(referenceImaginary[i] - voltagesImaginary[i]) > 1e-6)
+			return false;
+
+		if (abs(referenceReal[i] - iterativeVoltagesReal[i]) > 1e-6 || abs(referenceImaginary[i] - iterativeVoltagesImaginary[i]) > 1e-6)
+			return false;
+	}
+
+	return true;
+}
+
+// checks the default precision during the calculation, which determines the precision of all temporaries
+class CalculatorMultiPrecisionProbe :
+	public CalculatorMulti
+{
+public:
+	CalculatorMultiPrecisionProbe(int bitPrecision) :
+		CalculatorMulti(0, 40, 3, 3, 0, 1, bitPrecision, false),
+		_bitPrecision(bitPrecision),
+		_calculating(false),
+		_wrongPrecisionCount(0)
+	{ }
+
+	virtual void calculate()
+	{
+		_calculating = true;
+		CalculatorMulti::calculate();
+		_calculating = false;
+	}
+
+	virtual MultiPrecision createFloating(double value) const
+	{
+		if (_calculating && MultiPrecision::getBitPrecision() != _bitPrecision)
+			++_wrongPrecisionCount;
+
+		return CalculatorMulti::createFloating(value);
+	}
+
+	int getWrongPrecisionCount() const
+	{
+		return _wrongPrecisionCount;
+	}
+
+private:
+	unsigned int _bitPrecision;
+	bool _calculating;
+	mutable atomic<int> _wrongPrecisionCount;
+};
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorMultiPrecisionConcurrent()
+{
+	int const bitPrecisions[] = { 64, 1000, 128, 512, 100, 300, 200, 256 };
+	auto const count = 8;
+	vector<vector<double>> sequentialResults(count);
+	vector<vector<double>> concurrentResults(count);
+	auto calculate = [&bitPrecisions](int index, vector<double> &results)
+	{
+		CalculatorMultiPrecisionProbe calculator(bitPrecisions[index]);
+		setUpThreeNodeCalculator(calculator);
+		calculator.calculate();
+		results.resize(7);
+		calculator.getVoltages(results.data(), results.data() + 3);
+		results[6] = calculator.getWrongPrecisionCount();
+	};
+
+	for (auto i = 0; i < count; ++i)
+		calculate(i, sequentialResults[i]);
+
+	vector<thread> threads;
+
+	for (auto i = 0; i < count; ++i)
+		threads.push_back(thread(calculate, i, std::ref(concurrentResults[i])));
+
+	for (auto &thread : threads)
+		thread.join();
+
+	for (auto i = 0; i < count; ++i)
+	{
+		if (sequentialResults[i][6] != 0 || concurrentResults[i][6] != 0)
+			return false;
+
+		for (auto j = 0; j < 6; ++j)
+			if (abs(sequentialResults[i][j] - concurrentResults[i][j]) > 1e-12)
+				return false;
+	}
+
+	return true;
+}
+
+CancellationToken *progressCallbackCancellationToken = 0;
+atomic<int> progressCallbackCount(0);
+atomic<int> completionCallbackCount(0);
+int completionCallbackStates[8];
+
+void __stdcall cancelOnThirdProgress(int calculator, double progress, double relativePowerError)
+{
+	if (++progressCallbackCount == 3)
+		progressCallbackCancellationToken->cancel();
+}
+
+void __stdcall storeCompletionState(int calculator, int state)
+{
+	completionCallbackStates[calculator] = state;
+	++completionCallbackCount;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorCancellation()
+{
+	CalculatorLongDouble cancelledInAdvance(0, 80, 3, 3, 0, 1, false);
+	CancellationToken cancelledToken;
+	setUpThreeNodeCalculator(cancelledInAdvance);
+	cancelledToken.cancel();
+
+	if (!cancelledInAdvance.calculate(cancelledToken))
+		return false;
+
+	if (cancelledInAdvance.getCoefficientCount() != 2 || cancelledInAdvance.getProgress() == 1)
+		return false;
+
+	CalculatorLongDouble cancelledByCallback(0, 80, 3, 3, 0, 1, false);
+	CancellationToken token;
+	setUpThreeNodeCalculator(cancelledByCallback);
+	progressCallbackCancellationToken = &token;
+	progressCallbackCount = 0;
+	cancelledByCallback.setProgressCallback(cancelOnThirdProgress, 0);
+
+	if (!cancelledByCallback.calculate(token))
+		return false;
+
+	if (progressCallbackCount != 3 || cancelledByCallback.getCoefficientCount() != 3)
+		return false;
+
+	CalculatorLongDouble notCancelled(0, 80, 3, 3, 0, 1, false);
+	CancellationToken unusedToken;
+	setUpThreeNodeCalculator(notCancelled);
+
+	if (notCancelled.calculate(unusedToken))
+		return false;
+
+	double real[3];
+	double imaginary[3];
+	cancelledByCallback.getVoltages(real, imaginary);
+	return real[2] > 0.8 && real[2] < 1 && cancelledByCallback.getErrorHistoryCount() == 1;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorRegisterAsync()
+{
+	CalculatorLongDouble reference(0, 80, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(reference);
+	reference.calculate();
+	double referenceReal[3];
+	double referenceImaginary[3];
+	reference.getVoltages(referenceReal, referenceImaginary);
+	vector<int> calculators;
+	vector<CalculationState> states;
+	completionCallbackCount = 0;
+
+	{
+		CalculatorRegister calculatorRegister;
+
+		for (auto i = 0; i < 6; ++i)
+		{
+			calculators.push_back(calculatorRegister.createCalculatorLongDouble(0, 80, 3, 3, 0, 1, false));
+
+			if (i < 5)
+				setUpThreeNodeCalculator(calculatorRegister.get(calculators[i]));
+
+			if (calculatorRegister.getCalculationState(calculators[i]) != CalculationStateIdle)
+				return false;
+		}
+
+		for (auto i = 0; i < 6; ++i)
+		{
+			calculatorRegister.calculateAsync(calculators[i], storeCompletionState);
+
+			if (i == 4)
+				calculatorRegister.cancel(calculators[i]);
+		}
+
+		for (auto i = 0; i < 6; ++i)
+			states.push_back(calculatorRegister.wait(calculators[i]));
+
+		for (auto i = 0; i < 4; ++i)
+		{
+			double real[3];
+			double imaginary[3];
+			calculatorRegister.get(calculators[i]).getVoltages(real, imaginary);
+
+			for (auto j = 0; j < 3; ++j)
+				if (real[j] != referenceReal[j] || imaginary[j] != referenceImaginary[j])
+					return false;
+		}
+
+		calculatorRegister.calculateAsync(calculators[0], 0);
+		calculatorRegister.remove(calculators[0]);
+		calculatorRegister.shutdown();
+		calculatorRegister.calculateAsync(calculators[1], 0);
+
+		if (calculatorRegister.wait(calculators[1]) != CalculationStateFinished)
+			return false;
+
+		calculatorRegister.shutdown();
+		calculatorRegister.shutdown();
+	}
+
+	for (auto i = 0; i < 4; ++i)
+		if (states[i] != CalculationStateFinished || completionCallbackStates[calculators[i]] != CalculationStateFinished)
+			return false;
+
+	return	states[4] == CalculationStateCancelled && completionCallbackStates[calculators[4]] == CalculationStateCancelled &&
+			states[5] == CalculationStateFailed && completionCallbackStates[calculators[5]] == CalculationStateFailed &&
+			completionCallbackCount == 6;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorRegisterIds()
+{
+	CalculatorRegister calculatorRegister;
+	vector<int> ids;
+
+	for (auto i = 0; i < 40; ++i)
+		ids.push_back(calculatorRegister.createCalculatorLongDouble(0, 10 + i, 3, 3, 0, 1, false));
+
+	for (auto i = 0; i < 40; ++i)
+		if (ids[i] < 0 || count(ids.begin(), ids.end(), ids[i]) != 1 || calculatorRegister.get(ids[i]).getNodeCount() != 3)
+			return false;
+
+	auto removedId = ids[7];
+	calculatorRegister.remove(removedId);
+	ids.erase(ids.begin() + 7);
+	auto removedIdRejected = false;
+
+	try
+	{
+		calculatorRegister.get(removedId);
+	}
+	catch(out_of_range)
+	{
+		removedIdRejected = true;
+	}
+
+	if (!removedIdRejected)
+		return false;
+
+	vector<int> threadIds(8*50);
+	vector<thread> threads;
+
+	for (auto i = 0; i < 8; ++i)
+		threads.push_back(thread([&calculatorRegister, &threadIds, i]()
+		{
+			for (auto j = 0; j < 50; ++j)
+			{
+				auto temporary = calculatorRegister.createCalculatorLongDouble(0, 10, 3, 3, 0, 1, false);
+				threadIds[i*50 + j] = calculatorRegister.createCalculatorLongDouble(0, 10, 4, 3, 0, 1, false);
+				calculatorRegister.remove(temporary);
+			}
+		}));
+
+	for (auto &thread : threads)
+		thread.join();
+
+	for (auto id : threadIds)
+		if (count(threadIds.begin(), threadIds.end(), id) != 1 || count(ids.begin(), ids.end(), id) != 0 || calculatorRegister.get(id).getNodeCount() != 4)
+			return false;
+
+	return calculatorRegister.get(ids.back()).getNodeCount() == 3;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorContinuationInterval()
+{
+	CalculatorLongDouble reference(1e-10, 60, 3, 3, 0, 1, false);
+	CalculatorLongDouble calculator(1e-10, 60, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(reference);
+	setUpThreeNodeCalculator(calculator);
+	calculator.setContinuationInterval(3);
+
+	reference.calculate();
+	calculator.calculate();
+
+	double referenceReal[3];
+	double referenceImaginary[3];
+	double real[3];
+	double imaginary[3];
+	reference.getVoltages(referenceReal, referenceImaginary);
+	calculator.getVoltages(real, imaginary);
+
+	for (auto i = 0; i < 3; ++i)
+		if (abs(real[i] - referenceReal[i]) > 1e-9 || abs(imaginary[i] - referenceImaginary[i]) > 1e-9)
+			return false;
+
+	return calculator.getRelativePowerError() <= 1e-10 && calculator.getErrorHistoryCount() <= calculator.getCoefficientCount()/3;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorSentinelNodes()
+{
+	int const sentinels[] = { 2 };
+	CalculatorLongDouble reference(1e-10, 60, 3, 3, 0, 1, false);
+	CalculatorLongDouble calculator(1e-10, 60, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(reference);
+	setUpThreeNodeCalculator(calculator);
+	calculator.setSentinelNodes(1, sentinels);
+
+	reference.calculate();
+	calculator.calculate();
+
+	double referenceReal[3];
+	double referenceImaginary[3];
+	double real[3];
+	double imaginary[3];
+	reference.getVoltages(referenceReal, referenceImaginary);
+	calculator.getVoltages(real, imaginary);
+
+	for (auto i = 0; i < 3; ++i)
+		if (abs(real[i] - referenceReal[i]) > 1e-9 || abs(imaginary[i] - referenceImaginary[i]) > 1e-9)
+			return false;
+
+	return calculator.getRelativePowerError() <= 1e-9 && calculator.getCoefficientCount() < 60;
+}
+
+extern "C" __declspec(dllexport) bool __cdecl RunTestsCalculatorViskovatov()
+{
+	CalculatorLongDouble reference(1e-10, 60, 3, 3, 0, 1, false);
+	CalculatorLongDouble calculator(1e-10, 60, 3, 3, 0, 1, false);
+	setUpThreeNodeCalculator(reference);
+	setUpThreeNodeCalculator(calculator);
+	calculator.setAnalyticContinuationMethod(AnalyticContinuationMethodViskovatov);
+
+	reference.calculate();
+	calculator.calculate();
+
+	double referenceReal[3];
+	double referenceImaginary[3];
+	double real[3];
+	double imaginary[3];
+	reference.getVoltages(referenceReal, referenceImaginary);
+	calculator.getVoltages(real, imaginary);
+
+	for (auto i = 0; i < 3; ++i)
+		if (abs(real[i] - referenceReal[i]) > 1e-9 || abs(imaginary[i] - referenceImaginary[i]) > 1e-9)
+			return false;
+
+	return calculator.getRelativePowerError() <= 1e-10 && calculator.getCoefficientCount() <= reference.getCoefficientCount();
 }
\ No newline at end of file
@@ -1,14 +1,24 @@
 #include "Vector.h"
 #include "Complex.h"
 #include "MultiPrecision.h"
+#include "MultiPrecisionScope.h"
+#include "DoubleDouble.h"
+#include "QuadDouble.h"
 #include "NumericalTraits.h"
+#include "ComplexDoubleKernels.h"
 #include <assert.h>
 #include <string.h>
 #include <algorithm>
 #include <functional>
+#include <utility>
 
 template class Vector<long double, Complex<long double> >;
 template class Vector<MultiPrecision, Complex<MultiPrecision> >;
+template class Vector<DoubleDouble, Complex<DoubleDouble> >;
+template class Vector<QuadDouble, Complex<QuadDouble> >;
+template class Vector<double, Complex<double> >;
+
+static const int complexDoubleBlockSize = 1024;
 
 template<class Floating, class ComplexFloating>
 Vector<Floating, ComplexFloating>::Vector(int n) :
@@ -24,6 +34,19 @@ Vector<Floating, ComplexFloating>::Vector(Vector<Floating, ComplexFloating> cons
 	_values(rhs._values)
 { }
 
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating>::Vector(Vector<Floating, ComplexFloating> &&rhs) noexcept :
+	_count(rhs._count),
+	_values(std::move(rhs._values)),
+	_tempReal(std::move(rhs._tempReal)),
+	_tempImaginary(std::move(rhs._tempImaginary))
+{
+	rhs._count = 0;
+	rhs._values.clear();
+	rhs._tempReal.clear();
+	rhs._tempImaginary.clear();
+}
+
 template<class Floating, class ComplexFloating>
 int Vector<Floating, ComplexFloating>::getCount() const
 {
@@ -39,53 +62,32 @@ void Vector<Floating, ComplexFloating>::set(int i, ComplexFloating const &value)
 }
 
 template<class Floating, class ComplexFloating>
+template<class Summation>
 ComplexFloating Vector<Floating, ComplexFloating>::dot(Vector<Floating, ComplexFloating> const &rhs) const
 {
 	assert(getCount() == rhs.getCount());
-	_tempReal.resize(getCount());
-	_tempImaginary.resize(getCount());
-	
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-	{
-		auto value = _values[i]*rhs._values[i];
-		_tempReal[i] = std::real(value);
-		_tempImaginary[i] = std::imag(value);
-	}
-
-	std::sort(_tempReal.begin(), _tempReal.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-	std::sort(_tempImaginary.begin(), _tempImaginary.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-	ComplexFloating result;
-	
-	for (auto i = 0; i < _count; ++i)
-		result += ComplexFloating(_tempReal[i], _tempImaginary[i]);
+	reserveTemporaryValues();
+	calculateProducts(rhs);
+	return sumUpTemporaryValues<Summation>();
+}
 
-	return result;
+template<class Floating, class ComplexFloating>
+template<class Summation>
+ComplexFloating Vector<Floating, ComplexFloating>::conjugateDot(Vector<Floating, ComplexFloating> const &rhs) const
+{
+	assert(getCount() == rhs.getCount());
+	reserveTemporaryValues();
+	calculateConjugateProducts(rhs);
+	return sumUpTemporaryValues<Summation>();
 }
 
 template<class Floating, class ComplexFloating>
+template<class Summation>
 ComplexFloating Vector<Floating, ComplexFloating>::squaredNorm() const
 {
-	_tempReal.resize(getCount());
-	_tempImaginary.resize(getCount());
-	
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-	{
-		ComplexFloating const& value(_values[i]);
-		auto valueSquared = value*value;
-		_tempReal[i] = std::real(valueSquared);
-		_tempImaginary[i] = std::imag(valueSquared);
-	}
-	
-	std::sort(_tempReal.begin(), _tempReal.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-	std::sort(_tempImaginary.begin(), _tempImaginary.end(), [](Floating const &a, Floating const &b){ return std::abs(a) < std::abs(b); });
-	ComplexFloating result;
-	
-	for (auto i = 0; i < _count; ++i)
-		result += ComplexFloating(_tempReal[i], _tempImaginary[i]);
-
-	return result;
+	reserveTemporaryValues();
+	calculateSquares();
+	return sumUpTemporaryValues<Summation>();
 }
 
 template<class Floating, class ComplexFloating>
@@ -94,9 +96,16 @@ void Vector<Floating, ComplexFloating>::weightedSum(Vector<Floating, ComplexFloa
 	assert(getCount() == x.getCount());
 	assert(getCount() == y.getCount());
 
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-		_values[i] = x._values[i] + yWeight*y._values[i];
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = x._values[i] + yWeight*y._values[i];
+	}
 }
 
 template<class Floating, class ComplexFloating>
@@ -105,9 +114,16 @@ void Vector<Floating, ComplexFloating>::addWeightedSum(ComplexFloating const &xW
 	assert(getCount() == x.getCount());
 	assert(getCount() == y.getCount());
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-		_values[i] += xWeight*x._values[i] + yWeight*y._values[i];
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] += xWeight*x._values[i] + yWeight*y._values[i];
+	}
 }
 
 template<class Floating, class ComplexFloating>
@@ -116,9 +132,16 @@ void Vector<Floating, ComplexFloating>::pointwiseMultiply(Vector<Floating, Compl
 	assert(getCount() == x.getCount());
 	assert(getCount() == y.getCount());
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-		_values[i] = x._values[i]*y._values[i];
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = x._values[i]*y._values[i];
+	}
 }
 
 template<class Floating, class ComplexFloating>
@@ -127,9 +150,16 @@ void Vector<Floating, ComplexFloating>::subtract(Vector<Floating, ComplexFloatin
 	assert(getCount() == x.getCount());
 	assert(getCount() == y.getCount());
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-		_values[i] = x._values[i] - y._values[i];
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = x._values[i] - y._values[i];
+	}
 }
 
 template<class Floating, class ComplexFloating>
@@ -138,17 +168,68 @@ void Vector<Floating, ComplexFloating>::add(Vector<Floating, ComplexFloating> co
 	assert(getCount() == x.getCount());
 	assert(getCount() == y.getCount());
 	
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-		_values[i] = x._values[i] + y._values[i];
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = x._values[i] + y._values[i];
+	}
+}
+
+// equal to the multiplication with the permutation matrix which has the ones at (i, permutation[i])
+template<class Floating, class ComplexFloating>
+void Vector<Floating, ComplexFloating>::permutate(Vector<Floating, ComplexFloating> const &x, std::vector<int> const &permutation)
+{
+	assert(getCount() == x.getCount());
+	assert(getCount() == static_cast<int>(permutation.size()));
+	
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = x._values[permutation[i]];
+	}
+}
+
+template<class Floating, class ComplexFloating>
+void Vector<Floating, ComplexFloating>::permutateInverse(Vector<Floating, ComplexFloating> const &x, std::vector<int> const &permutation)
+{
+	assert(getCount() == x.getCount());
+	assert(getCount() == static_cast<int>(permutation.size()));
+	
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[permutation[i]] = x._values[i];
+	}
 }
 
 template<class Floating, class ComplexFloating>
 void Vector<Floating, ComplexFloating>::conjugate()
 {
-	#pragma omp parallel for
-	for (auto i = 0; i < _count; ++i)
-		_values[i] = std::conj(_values[i]);
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = std::conj(_values[i]);
+	}
 }
 
 template<typename Floating, typename ComplexFloating> 
@@ -169,6 +250,14 @@ ComplexFloating const& Vector<Floating, ComplexFloating>::operator()(int i) cons
 	return _values[i];
 }
 
+template<class Floating, class ComplexFloating>
+ComplexFloating& Vector<Floating, ComplexFloating>::operator()(int i)
+{
+	assert(i < _count);
+	assert(i >= 0);
+	return _values[i];
+}
+
 template<class Floating, class ComplexFloating>
 Vector<Floating, ComplexFloating> const& Vector<Floating, ComplexFloating>::operator=(Vector<Floating, ComplexFloating> const& rhs)
 {
@@ -177,12 +266,257 @@ Vector<Floating, ComplexFloating> const& Vector<Floating, ComplexFloating>::oper
 	return *this;
 }
 
+template<class Floating, class ComplexFloating>
+Vector<Floating, ComplexFloating> const& Vector<Floating, ComplexFloating>::operator=(Vector<Floating, ComplexFloating> &&rhs)
+{
+	assert(getCount() == rhs.getCount());
+	_values.swap(rhs._values);
+	return *this;
+}
+
 template<class Floating, class ComplexFloating>
 void Vector<Floating, ComplexFloating>::setToZero()
 {
 	ComplexFloating zero(Floating(0));
-	#pragma omp parallel for
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+			_values[i] = zero;
+	}
+}
+
+// the temporary values are kept, therefore only the first reduction of a vector allocates them
+template<class Floating, class ComplexFloating>
+void Vector<Floating, ComplexFloating>::reserveTemporaryValues() const
+{
+	if (static_cast<int>(_tempReal.size()) == _count)
+		return;
+
+	_tempReal.resize(_count);
+	_tempImaginary.resize(_count);
+}
+
+template<class Floating, class ComplexFloating>
+void Vector<Floating, ComplexFloating>::calculateProducts(Vector<Floating, ComplexFloating> const &rhs) const
+{
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+		{
+			auto value = _values[i]*rhs._values[i];
+			_tempReal[i] = std::real(value);
+			_tempImaginary[i] = std::imag(value);
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+void Vector<Floating, ComplexFloating>::calculateConjugateProducts(Vector<Floating, ComplexFloating> const &rhs) const
+{
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+		{
+			auto value = std::conj(_values[i])*rhs._values[i];
+			_tempReal[i] = std::real(value);
+			_tempImaginary[i] = std::imag(value);
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+void Vector<Floating, ComplexFloating>::calculateSquares() const
+{
+	auto const bitPrecision = MultiPrecision::getBitPrecision();
+
+	#pragma omp parallel
+	{
+		MultiPrecisionScope scope(bitPrecision);
+
+		#pragma omp for
+		for (auto i = 0; i < _count; ++i)
+		{
+			ComplexFloating const& value(_values[i]);
+			auto valueSquared = value*value;
+			_tempReal[i] = std::real(valueSquared);
+			_tempImaginary[i] = std::imag(valueSquared);
+		}
+	}
+}
+
+template<class Floating, class ComplexFloating>
+template<class Summation>
+ComplexFloating Vector<Floating, ComplexFloating>::sumUpTemporaryValues() const
+{
+	Summation real;
+	Summation imaginary;
+
 	for (auto i = 0; i < _count; ++i)
-		_values[i] = zero;
+	{
+		real.add(_tempReal[i]);
+		imaginary.add(_tempImaginary[i]);
+	}
+
+	return ComplexFloating(real.getResult(), imaginary.getResult());
+}
+
+// the kernels work on blocks, which are distributed over the threads like the single elements of the generic versions
+static int getBlockCount(int count)
+{
+	return (count + complexDoubleBlockSize - 1)/complexDoubleBlockSize;
+}
+
+template<>
+void Vector<double, Complex<double>>::calculateProducts(Vector<double, Complex<double>> const &rhs) const
+{
+	auto blockCount = getBlockCount(_count);
+
+	#pragma omp parallel for
+	for (auto block = 0; block < blockCount; ++block)
+	{
+		auto start = block*complexDoubleBlockSize;
+		calculateComplexProducts(&_values[start], &rhs._values[start], std::min(complexDoubleBlockSize, _count - start), false, &_tempReal[start], &_tempImaginary[start]);
+	}
+}
+
+template<>
+void Vector<double, Complex<double>>::calculateConjugateProducts(Vector<double, Complex<double>> const &rhs) const
+{
+	auto blockCount = getBlockCount(_count);
+
+	#pragma omp parallel for
+	for (auto block = 0; block < blockCount; ++block)
+	{
+		auto start = block*complexDoubleBlockSize;
+		calculateComplexProducts(&_values[start], &rhs._values[start], std::min(complexDoubleBlockSize, _count - start), true, &_tempReal[start], &_tempImaginary[start]);
+	}
+}
+
+template<>
+void Vector<double, Complex<double>>::calculateSquares() const
+{
+	auto blockCount = getBlockCount(_count);
+
+	#pragma omp parallel for
+	for (auto block = 0; block < blockCount; ++block)
+	{
+		auto start = block*complexDoubleBlockSize;
+		calculateComplexProducts(&_values[start], &_values[start], std::min(complexDoubleBlockSize, _count - start), false, &_tempReal[start], &_tempImaginary[start]);
+	}
+}
+
+template<>
+void Vector<double, Complex<double>>::weightedSum(Vector<double, Complex<double>> const &x, Complex<double> const &yWeight, Vector<double, Complex<double>> const &y)
+{
+	assert(getCount() == x.getCount());
+	assert(getCount() == y.getCount());
+	auto blockCount = getBlockCount(_count);
+
+	#pragma omp parallel for
+	for (auto block = 0; block < blockCount; ++block)
+	{
+		auto start = block*complexDoubleBlockSize;
+		calculateComplexWeightedSum(&_values[start], &x._values[start], yWeight, &y._values[start], std::min(complexDoubleBlockSize, _count - start));
+	}
+}
+
+template<>
+void Vector<double, Complex<double>>::addWeightedSum(Complex<double> const &xWeight, Vector<double, Complex<double>> const &x, Complex<double> const &yWeight, Vector<double, Complex<double>> const &y)
+{
+	assert(getCount() == x.getCount());
+	assert(getCount() == y.getCount());
+	auto blockCount = getBlockCount(_count);
+
+	#pragma omp parallel for
+	for (auto block = 0; block < blockCount; ++block)
+	{
+		auto start = block*complexDoubleBlockSize;
+		addComplexWeightedSum(&_values[start], xWeight, &x._values[start], yWeight, &y._values[start], std::min(complexDoubleBlockSize, _count - start));
+	}
+}
+
+template<>
+template<>
+Complex<double> Vector<double, Complex<double>>::sumUpTemporaryValues<SummationNeumaier<double>>() const
+{
+	if (_count == 0)
+		return Complex<double>();
+
+	return Complex<double>(calculateCompensatedSum(&_tempReal[0], _count), calculateCompensatedSum(&_tempImaginary[0], _count));
 }
 
+template Complex<long double> Vector<long double, Complex<long double> >::dot<SummationNaive<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::dot<SummationNeumaier<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::dot<SummationPairwise<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::dot<SummationSorted<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::dot<SummationNaive<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::dot<SummationNeumaier<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::dot<SummationPairwise<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::dot<SummationSorted<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::dot<SummationNaive<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::dot<SummationNeumaier<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::dot<SummationPairwise<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::dot<SummationSorted<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::dot<SummationNaive<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::dot<SummationNeumaier<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::dot<SummationPairwise<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::dot<SummationSorted<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::dot<SummationNaive<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::dot<SummationNeumaier<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::dot<SummationPairwise<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::dot<SummationSorted<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::conjugateDot<SummationNaive<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::conjugateDot<SummationNeumaier<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::conjugateDot<SummationPairwise<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::conjugateDot<SummationSorted<long double> >(Vector<long double, Complex<long double> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::conjugateDot<SummationNaive<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::conjugateDot<SummationNeumaier<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::conjugateDot<SummationPairwise<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::conjugateDot<SummationSorted<MultiPrecision> >(Vector<MultiPrecision, Complex<MultiPrecision> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::conjugateDot<SummationNaive<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::conjugateDot<SummationNeumaier<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::conjugateDot<SummationPairwise<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::conjugateDot<SummationSorted<DoubleDouble> >(Vector<DoubleDouble, Complex<DoubleDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::conjugateDot<SummationNaive<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::conjugateDot<SummationNeumaier<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::conjugateDot<SummationPairwise<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::conjugateDot<SummationSorted<QuadDouble> >(Vector<QuadDouble, Complex<QuadDouble> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::conjugateDot<SummationNaive<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::conjugateDot<SummationNeumaier<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::conjugateDot<SummationPairwise<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<double> Vector<double, Complex<double> >::conjugateDot<SummationSorted<double> >(Vector<double, Complex<double> > const &rhs) const;
+template Complex<long double> Vector<long double, Complex<long double> >::squaredNorm<SummationNaive<long double> >() const;
+template Complex<long double> Vector<long double, Complex<long double> >::squaredNorm<SummationNeumaier<long double> >() const;
+template Complex<long double> Vector<long double, Complex<long double> >::squaredNorm<SummationPairwise<long double> >() const;
+template Complex<long double> Vector<long double, Complex<long double> >::squaredNorm<SummationSorted<long double> >() const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::squaredNorm<SummationNaive<MultiPrecision> >() const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::squaredNorm<SummationNeumaier<MultiPrecision> >() const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::squaredNorm<SummationPairwise<MultiPrecision> >() const;
+template Complex<MultiPrecision> Vector<MultiPrecision, Complex<MultiPrecision> >::squaredNorm<SummationSorted<MultiPrecision> >() const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::squaredNorm<SummationNaive<DoubleDouble> >() const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::squaredNorm<SummationNeumaier<DoubleDouble> >() const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::squaredNorm<SummationPairwise<DoubleDouble> >() const;
+template Complex<DoubleDouble> Vector<DoubleDouble, Complex<DoubleDouble> >::squaredNorm<SummationSorted<DoubleDouble> >() const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::squaredNorm<SummationNaive<QuadDouble> >() const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::squaredNorm<SummationNeumaier<QuadDouble> >() const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::squaredNorm<SummationPairwise<QuadDouble> >() const;
+template Complex<QuadDouble> Vector<QuadDouble, Complex<QuadDouble> >::squaredNorm<SummationSorted<QuadDouble> >() const;
+template Complex<double> Vector<double, Complex<double> >::squaredNorm<SummationNaive<double> >() const;
+template Complex<double> Vector<double, Complex<double> >::squaredNorm<SummationNeumaier<double> >() const;
+template Complex<double> Vector<double, Complex<double> >::squaredNorm<SummationPairwise<double> >() const;
+template Complex<double> Vector<double, Complex<double> >::squaredNorm<SummationSorted<double> >() const;
\ No newline at end of file
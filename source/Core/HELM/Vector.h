@@ -4,6 +4,9 @@
 #include <string>
 #include <iostream>
 #include <sstream>
+#include "Summation.h"
+
+template<typename T> class Complex;
 
 template<class Floating, class ComplexFloating>
 class Vector
@@ -11,32 +14,60 @@ class Vector
 public:
 	Vector(int n);
 	Vector(Vector<Floating, ComplexFloating> const &rhs);
+	// the values are taken over without a copy, and the moved from vector is left empty
+	Vector(Vector<Floating, ComplexFloating> &&rhs) noexcept;
 
 	int getCount() const;
 	void set(int i, ComplexFloating const &value);
-	ComplexFloating dot(Vector<Floating, ComplexFloating> const &rhs) const;
-	ComplexFloating squaredNorm() const;
+	template<class Summation = SummationNeumaier<Floating>> ComplexFloating dot(Vector<Floating, ComplexFloating> const &rhs) const;
+	template<class Summation = SummationNeumaier<Floating>> ComplexFloating conjugateDot(Vector<Floating, ComplexFloating> const &rhs) const;
+	template<class Summation = SummationNeumaier<Floating>> ComplexFloating squaredNorm() const;
 	void weightedSum(Vector<Floating, ComplexFloating> const &x, ComplexFloating const &yWeight, Vector<Floating, ComplexFloating> const &y);
 	void addWeightedSum(ComplexFloating const &xWeight, Vector<Floating, ComplexFloating> const &x, ComplexFloating const &yWeight, Vector<Floating, ComplexFloating> const &y);
 	void pointwiseMultiply(Vector<Floating, ComplexFloating> const &x, Vector<Floating, ComplexFloating> const &y);
 	void subtract(Vector<Floating, ComplexFloating> const &x, Vector<Floating, ComplexFloating> const &y);
 	void add(Vector<Floating, ComplexFloating> const &x, Vector<Floating, ComplexFloating> const &y);
+	void permutate(Vector<Floating, ComplexFloating> const &x, std::vector<int> const &permutation);
+	void permutateInverse(Vector<Floating, ComplexFloating> const &x, std::vector<int> const &permutation);
 	void conjugate();
+	void setToZero();
 	bool isFinite() const;
 
 	ComplexFloating const& operator()(int i) const;
+	ComplexFloating& operator()(int i);
 	Vector<Floating, ComplexFloating> const& operator=(Vector<Floating, ComplexFloating> const &rhs);
+	// the values are exchanged, therefore the moved from vector keeps its size
+	Vector<Floating, ComplexFloating> const& operator=(Vector<Floating, ComplexFloating> &&rhs);
 
 private:
-	void setToZero();
+	void reserveTemporaryValues() const;
+	void calculateProducts(Vector<Floating, ComplexFloating> const &rhs) const;
+	void calculateConjugateProducts(Vector<Floating, ComplexFloating> const &rhs) const;
+	void calculateSquares() const;
+	template<class Summation> ComplexFloating sumUpTemporaryValues() const;
 
 private:
-	const int _count;
+	int _count;
 	std::vector<ComplexFloating> _values;
 	mutable std::vector<Floating> _tempReal;
 	mutable std::vector<Floating> _tempImaginary;
 };
 
+// these use the vectorized kernels for double
+template<>
+void Vector<double, Complex<double>>::calculateProducts(Vector<double, Complex<double>> const &rhs) const;
+template<>
+void Vector<double, Complex<double>>::calculateConjugateProducts(Vector<double, Complex<double>> const &rhs) const;
+template<>
+void Vector<double, Complex<double>>::calculateSquares() const;
+template<>
+void Vector<double, Complex<double>>::weightedSum(Vector<double, Complex<double>> const &x, Complex<double> const &yWeight, Vector<double, Complex<double>> const &y);
+template<>
+void Vector<double, Complex<double>>::addWeightedSum(Complex<double> const &xWeight, Vector<double, Complex<double>> const &x, Complex<double> const &yWeight, Vector<double, Complex<double>> const &y);
+template<>
+template<>
+Complex<double> Vector<double, Complex<double>>::sumUpTemporaryValues<SummationNeumaier<double>>() const;
+
 template<class Floating, class ComplexFloating>
 bool operator==(Vector<Floating, ComplexFloating> const &one, Vector<Floating, ComplexFloating> const &two)
 {
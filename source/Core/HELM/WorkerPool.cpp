@@ -0,0 +1,66 @@
+#include "WorkerPool.h"
+#include "CalculationJob.h"
+#include <assert.h>
+
+using namespace std;
+
+WorkerPool::WorkerPool(int threadCount) :
+	_stopping(false)
+{
+	assert(threadCount > 0);
+
+	for (auto i = 0; i < threadCount; ++i)
+		_threads.push_back(thread(&WorkerPool::work, this));
+}
+
+WorkerPool::~WorkerPool()
+{
+	{
+		lock_guard<mutex> lock(_mutex);
+		_stopping = true;
+	}
+
+	_jobAvailable.notify_all();
+
+	for (auto &worker : _threads)
+		worker.join();
+}
+
+void WorkerPool::enqueue(CalculationJob &job)
+{
+	{
+		lock_guard<mutex> lock(_mutex);
+		assert(!_stopping);
+		_jobs.push_back(&job);
+	}
+
+	_jobAvailable.notify_one();
+}
+
+int WorkerPool::getThreadCount() const
+{
+	return _threads.size();
+}
+
+void WorkerPool::work()
+{
+	while (true)
+	{
+		CalculationJob *job;
+
+		{
+			unique_lock<mutex> lock(_mutex);
+
+			while (_jobs.empty() && !_stopping)
+				_jobAvailable.wait(lock);
+
+			if (_jobs.empty())
+				return;
+
+			job = _jobs.front();
+			_jobs.pop_front();
+		}
+
+		job->run();
+	}
+}
\ No newline at end of file
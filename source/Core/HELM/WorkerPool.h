@@ -0,0 +1,33 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+class CalculationJob;
+
+// executes the jobs in the order of their arrival, the destructor finishes all queued jobs before it stops the threads
+class WorkerPool
+{
+public:
+	WorkerPool(int threadCount);
+	~WorkerPool();
+
+	void enqueue(CalculationJob &job);
+	int getThreadCount() const;
+
+private:
+	WorkerPool(WorkerPool const &rhs);
+	void operator=(WorkerPool const &rhs);
+
+	void work();
+
+private:
+	std::vector<std::thread> _threads;
+	std::deque<CalculationJob*> _jobs;
+	std::mutex _mutex;
+	std::condition_variable _jobAvailable;
+	bool _stopping;
+};
\ No newline at end of file
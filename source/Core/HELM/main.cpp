@@ -1,11 +1,14 @@
 #include "CalculatorRegister.h"
 #include "ConsoleOutput.h"
+#include "ProgressCallback.h"
+#include "CompletionCallback.h"
 #include "UnitTest.h"
 #include "MultiPrecision.h"
 #include <Windows.h>
 
 using namespace std;
 
+// destroyed together with the DLL, therefore the callers have to stop the calculations with ShutdownCalculations before
 CalculatorRegister calculatorRegister;
 
 extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
@@ -18,6 +21,31 @@ extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorMultiPrecis
 	return calculatorRegister.createCalculatorMultiPrecision(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, bitPrecision, iterativeSolver);
 }
 
+extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
+{
+	return calculatorRegister.createCalculatorDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver);
+}
+
+extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorDoubleDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
+{
+	return calculatorRegister.createCalculatorDoubleDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver);
+}
+
+extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorQuadDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, bool iterativeSolver)
+{
+	return calculatorRegister.createCalculatorQuadDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, iterativeSolver);
+}
+
+extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorBatchLongDouble(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int scenarioCount, bool iterativeSolver)
+{
+	return calculatorRegister.createCalculatorBatchLongDouble(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, scenarioCount, iterativeSolver);
+}
+
+extern "C" __declspec(dllexport) int __cdecl CreateLoadFlowCalculatorBatchMultiPrecision(double targetPrecision, int numberOfCoefficients, int nodeCount, int pqBusCount, int pvBusCount, double nominalVoltage, int bitPrecision, int scenarioCount, bool iterativeSolver)
+{
+	return calculatorRegister.createCalculatorBatchMultiPrecision(targetPrecision, numberOfCoefficients, nodeCount, pqBusCount, pvBusCount, nominalVoltage, bitPrecision, scenarioCount, iterativeSolver);
+}
+
 extern "C" __declspec(dllexport) void __cdecl DeleteLoadFlowCalculator(int calculator)
 {
 	calculatorRegister.remove(calculator);
@@ -48,11 +76,115 @@ extern "C" __declspec(dllexport) void __cdecl SetConstantCurrent(int calculator,
 	calculatorRegister.get(calculator).setConstantCurrent(node, Complex<long double>(real, imaginary));
 }
 
+extern "C" __declspec(dllexport) void __cdecl SetAdmittances(int calculator, int count, int const *rows, int const *columns, double const *real, double const *imaginary)
+{
+	calculatorRegister.get(calculator).setAdmittances(count, rows, columns, real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetAdmittancesCompressed(int calculator, int const *rowPointers, int const *columns, double const *real, double const *imaginary)
+{
+	calculatorRegister.get(calculator).setAdmittancesCompressed(rowPointers, columns, real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetAdmittanceRowSums(int calculator, double const *real, double const *imaginary)
+{
+	calculatorRegister.get(calculator).setAdmittanceRowSums(real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetPQBuses(int calculator, int const *nodes, double const *powerReal, double const *powerImaginary)
+{
+	calculatorRegister.get(calculator).setPQBuses(nodes, powerReal, powerImaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetPVBuses(int calculator, int const *nodes, double const *powerReal, double const *voltageMagnitude)
+{
+	calculatorRegister.get(calculator).setPVBuses(nodes, powerReal, voltageMagnitude);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetConstantCurrents(int calculator, double const *real, double const *imaginary)
+{
+	calculatorRegister.get(calculator).setConstantCurrents(real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetPQBusesOfScenario(int calculator, int scenario, int const *nodes, double const *powerReal, double const *powerImaginary)
+{
+	calculatorRegister.get(calculator).setPQBusesOfScenario(scenario, nodes, powerReal, powerImaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetPVBusesOfScenario(int calculator, int scenario, int const *nodes, double const *powerReal, double const *voltageMagnitude)
+{
+	calculatorRegister.get(calculator).setPVBusesOfScenario(scenario, nodes, powerReal, voltageMagnitude);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetContinuationInterval(int calculator, int stepCount)
+{
+	calculatorRegister.get(calculator).setContinuationInterval(stepCount);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetSentinelNodes(int calculator, int count, int const *nodes)
+{
+	calculatorRegister.get(calculator).setSentinelNodes(count, nodes);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetAnalyticContinuationMethod(int calculator, int method)
+{
+	calculatorRegister.get(calculator).setAnalyticContinuationMethod(static_cast<AnalyticContinuationMethod>(method));
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetBiCGSTABPreconditioner(int calculator, int preconditioner)
+{
+	calculatorRegister.get(calculator).setBiCGSTABPreconditioner(static_cast<BiCGSTABPreconditioner>(preconditioner));
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetSolutionHistoryLength(int calculator, int length)
+{
+	calculatorRegister.get(calculator).setSolutionHistoryLength(length);
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetIterativeSolverTolerance(int calculator, double tolerance)
+{
+	calculatorRegister.get(calculator).setIterativeSolverTolerance(tolerance);
+}
+
 extern "C" __declspec(dllexport) void __cdecl Calculate(int calculator)
 {
 	calculatorRegister.get(calculator).calculate();
 }
 
+// the calculation runs on a worker of the pool, the completion callback is called from this worker too
+extern "C" __declspec(dllexport) void __cdecl CalculateAsync(int calculator, CompletionCallback completionCallback)
+{
+	calculatorRegister.calculateAsync(calculator, completionCallback);
+}
+
+extern "C" __declspec(dllexport) void __cdecl CancelCalculation(int calculator)
+{
+	calculatorRegister.cancel(calculator);
+}
+
+extern "C" __declspec(dllexport) int __cdecl WaitForCalculation(int calculator)
+{
+	return calculatorRegister.wait(calculator);
+}
+
+extern "C" __declspec(dllexport) int __cdecl GetCalculationState(int calculator)
+{
+	return calculatorRegister.getCalculationState(calculator);
+}
+
+// cancels all calculations and stops the workers, callers must call this before the DLL is unloaded with FreeLibrary or the process exits,
+// because the threads of the workers can not be joined safely during the destruction of the global register,
+// without it a calculation which is still running keeps its calculator, which is then never freed
+extern "C" __declspec(dllexport) void __cdecl ShutdownCalculations()
+{
+	calculatorRegister.shutdown();
+}
+
+extern "C" __declspec(dllexport) void __cdecl SetProgressCallback(int calculator, ProgressCallback callback)
+{
+	calculatorRegister.get(calculator).setProgressCallback(callback, calculator);
+}
+
 extern "C" __declspec(dllexport) double __cdecl GetVoltageReal(int calculator, int node)
 {
 	return calculatorRegister.get(calculator).getVoltageReal(node);
@@ -83,6 +215,41 @@ extern "C" __declspec(dllexport) double __cdecl GetInverseCoefficientImaginary(i
 	return calculatorRegister.get(calculator).getInverseCoefficientImaginary(step, node);
 }
 
+extern "C" __declspec(dllexport) void __cdecl GetVoltages(int calculator, double *real, double *imaginary)
+{
+	calculatorRegister.get(calculator).getVoltages(real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl GetVoltagesOfScenario(int calculator, int scenario, double *real, double *imaginary)
+{
+	calculatorRegister.get(calculator).getVoltagesOfScenario(scenario, real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl GetCoefficients(int calculator, int step, double *real, double *imaginary)
+{
+	calculatorRegister.get(calculator).getCoefficients(step, real, imaginary);
+}
+
+extern "C" __declspec(dllexport) void __cdecl GetInverseCoefficients(int calculator, int step, double *real, double *imaginary)
+{
+	calculatorRegister.get(calculator).getInverseCoefficients(step, real, imaginary);
+}
+
+extern "C" __declspec(dllexport) int __cdecl GetErrorHistoryCount(int calculator)
+{
+	return calculatorRegister.get(calculator).getErrorHistoryCount();
+}
+
+extern "C" __declspec(dllexport) void __cdecl GetErrorHistory(int calculator, double *errors)
+{
+	calculatorRegister.get(calculator).getErrorHistory(errors);
+}
+
+extern "C" __declspec(dllexport) int __cdecl GetCoefficientCount(int calculator)
+{
+	return calculatorRegister.get(calculator).getCoefficientCount();
+}
+
 extern "C" __declspec(dllexport) int __cdecl GetLastNodeCount(int calculator)
 {
 	return calculatorRegister.get(calculator).getNodeCount();
@@ -113,7 +280,6 @@ BOOL APIENTRY DllMain(HANDLE hModule,
 	{
     case DLL_PROCESS_ATTACH:
     case DLL_THREAD_ATTACH:
-		MultiPrecision::setDefaultPrecision();
     case DLL_THREAD_DETACH:
     case DLL_PROCESS_DETACH:
 		break;